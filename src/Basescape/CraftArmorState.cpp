@@ -226,7 +226,7 @@ void CraftArmorState::cbxSortByChange(Action *action)
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				compFunc->sort(*_base->getSoldiers());
 			}
 			if (_game->isShiftPressed())
 			{
@@ -456,7 +456,7 @@ void CraftArmorState::lstSoldiersClick(Action *action)
 	}
 
 	Soldier *s = _base->getSoldiers()->at(_lstSoldiers->getSelectedRow());
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		if (action->getDetails()->button.button == SDL_BUTTON_LEFT)
 		{
@@ -584,7 +584,7 @@ void CraftArmorState::btnDeequipAllArmorClick(Action *action)
 	int row = 0;
 	for (auto* soldier : *_base->getSoldiers())
 	{
-		if (!(soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT"))
+		if (!(soldier->getCraft() && soldier->getCraft()->getStatus() == CRAFT_OUT))
 		{
 			Armor *a = soldier->getRules()->getDefaultArmor();
 
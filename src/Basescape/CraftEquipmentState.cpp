@@ -929,7 +929,7 @@ void CraftEquipmentState::btnClearClick(Action *)
 	if (_isNewBattle)
 	{
 		Craft* c = _base->getCrafts()->at(_craft);
-		c->getItems()->getContents()->clear();
+		c->getItems()->clear();
 	}
 }
 
@@ -955,14 +955,14 @@ void CraftEquipmentState::btnInventoryClick(Action *)
 			// Note: the current implementation assumes no limit to the number or size of items a craft can hold.
 			//       If the craft has limited space, then we just won't have all the base items available on the inventory screen.
 
-			auto& extras = *craft->getExtraItems()->getContents();
-			extras.clear();
+			auto* extras = craft->getExtraItems();
+			extras->clear();
 			for (_sel = 0; _sel != _items.size(); ++_sel)
 			{
 				const auto& itemType = _items[_sel];
 				if (craft->getItems()->getItem(itemType) > 0)
 				{
-					extras[itemType] = craft->getItems()->getItem(itemType) - craft->getSoldierItems()->getItem(itemType);
+					extras->addItem(itemType, craft->getItems()->getItem(itemType) - craft->getSoldierItems()->getItem(itemType));
 				}
 				RuleItem* rule = _game->getMod()->getItem(itemType);
 				if (!rule->getVehicleUnit() && rule->canBeEquippedBeforeBaseDefense())
@@ -992,7 +992,7 @@ void CraftEquipmentState::saveGlobalLoadout(int index)
 {
 	// clear the template
 	ItemContainer *tmpl = _game->getSavedGame()->getGlobalCraftLoadout(index);
-	tmpl->getContents()->clear();
+	tmpl->clear();
 
 	Craft *c = _base->getCrafts()->at(_craft);
 	// save only what is visible on the screen (can be DIFFERENT than what's really in the craft for various reasons)
@@ -1057,12 +1057,12 @@ void CraftEquipmentState::loadGlobalLoadout(int index, bool onlyAddItems)
 	// lastly check and report what's missing
 	std::string craftName = c->getName(_game->getLanguage());
 	std::vector<ReequipStat> _missingItems;
-	for (const auto& templateItem : *tmpl->getContents())
+	for (const auto& templateItem : tmpl->getSortedEntries())
 	{
-		RuleItem *item = _game->getMod()->getItem(templateItem.first, false);
+		RuleItem *item = _game->getMod()->getItemByTypeIndex(templateItem.index, false);
 		if (item)
 		{
-			int tQty = templateItem.second;
+			int tQty = templateItem.qty;
 			int cQty = 0;
 			if (item->getVehicleUnit())
 			{
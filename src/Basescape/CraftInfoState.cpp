@@ -228,7 +228,7 @@ void CraftInfoState::init()
 
 	std::ostringstream firlsLine;
 	firlsLine << tr("STR_DAMAGE_UC_").arg(Unicode::formatPercentage(_craft->getDamagePercentage()));
-	if (_craft->getStatus() == "STR_REPAIRS" && _craft->getDamage() > 0)
+	if (_craft->getStatus() == CRAFT_REPAIRS && _craft->getDamage() > 0)
 	{
 		int damageHours = (int)ceil((double)_craft->getDamage() / _craft->getRules()->getRepairRate());
 		firlsLine << formatTime(damageHours);
@@ -237,7 +237,7 @@ void CraftInfoState::init()
 
 	std::ostringstream secondLine;
 	secondLine << tr("STR_FUEL").arg(Unicode::formatPercentage(_craft->getFuelPercentage()));
-	if (_craft->getStatus() == "STR_REFUELLING" && _craft->getFuelMax() - _craft->getFuel() > 0)
+	if (_craft->getStatus() == CRAFT_REFUELLING && _craft->getFuelMax() - _craft->getFuel() > 0)
 	{
 		int fuelHours = (int)ceil((double)(_craft->getFuelMax() - _craft->getFuel()) / _craft->getRules()->getRefuelRate() / 2.0);
 		secondLine << formatTime(fuelHours);
@@ -352,7 +352,7 @@ void CraftInfoState::init()
 			{
 				weaponLine << tr("STR_AMMO_").arg(w1->getAmmo()) << "\n" << Unicode::TOK_COLOR_FLIP;
 				weaponLine << tr("STR_MAX").arg(w1->getRules()->getAmmoMax());
-				if (_craft->getStatus() == "STR_REARMING" && w1->getAmmo() < w1->getRules()->getAmmoMax() && !w1->isDisabled())
+				if (_craft->getStatus() == CRAFT_REARMING && w1->getAmmo() < w1->getRules()->getAmmoMax() && !w1->isDisabled())
 				{
 					int rearmHours = (int)ceil((double)(w1->getRules()->getAmmoMax() - w1->getAmmo()) / w1->getRules()->getRearmRate());
 					weaponLine << formatTime(rearmHours);
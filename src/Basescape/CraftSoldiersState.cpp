@@ -250,7 +250,7 @@ void CraftSoldiersState::cbxSortByChange(Action *)
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				compFunc->sort(*_base->getSoldiers());
 			}
 			if (_game->isShiftPressed())
 			{
@@ -518,7 +518,7 @@ void CraftSoldiersState::lstSoldiersClick(Action *action)
 			s->setCraftAndMoveEquipment(0, _base, _game->getSavedGame()->getMonthsPassed() == -1);
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
 		}
-		else if (s->getCraft() && s->getCraft()->getStatus() == "STR_OUT")
+		else if (s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT)
 		{
 			color = _otherCraftColor;
 		}
@@ -592,12 +592,12 @@ void CraftSoldiersState::btnDeassignAllSoldiersClick(Action *action)
 	for (auto* soldier : *_base->getSoldiers())
 	{
 		color = _lstSoldiers->getColor();
-		if (soldier->getCraft() && soldier->getCraft()->getStatus() != "STR_OUT")
+		if (soldier->getCraft() && soldier->getCraft()->getStatus() != CRAFT_OUT)
 		{
 			soldier->setCraftAndMoveEquipment(0, _base, _game->getSavedGame()->getMonthsPassed() == -1);
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
 		}
-		else if (soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT")
+		else if (soldier->getCraft() && soldier->getCraft()->getStatus() == CRAFT_OUT)
 		{
 			color = _otherCraftColor;
 		}
@@ -1,5 +1,7 @@
 #include "SoldierSortUtil.h"
 #include "../Mod/RuleSoldier.h"
+#include <algorithm>
+#include <utility>
 
 #define GET_ATTRIB_STAT_FN(attrib) \
 	int OpenXcom::attrib##Stat(const Game *game, const Soldier *s) { return s->getStatsWithAllBonuses()->attrib; }
@@ -161,3 +163,29 @@ int OpenXcom::idleDaysStat(const Game *game, const Soldier *s)
 	return game->getSavedGame()->getSoldierIdleDays(s);
 }
 #undef GET_SOLDIER_STAT_FN
+
+/**
+ * Sorts the soldiers by the stat, keeping the order of equal soldiers.
+ * Some stats are not cheap (e.g. idle days look through the mission history),
+ * so each soldier's stat is read once before sorting, not on every comparison.
+ * @param soldiers List of soldiers to sort.
+ */
+void OpenXcom::SortFunctor::sort(std::vector<Soldier*> &soldiers) const
+{
+	std::vector<std::pair<int, Soldier*> > keys;
+	keys.reserve(soldiers.size());
+	for (auto* soldier : soldiers)
+	{
+		keys.push_back(std::make_pair(_getStatFn(_game, soldier), soldier));
+	}
+	std::stable_sort(keys.begin(), keys.end(),
+		[](const std::pair<int, Soldier*> &a, const std::pair<int, Soldier*> &b)
+		{
+			return a.first < b.first;
+		}
+	);
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		soldiers[i] = keys[i].second;
+	}
+}
@@ -17,6 +17,7 @@
  * You should have received a copy of the GNU General Public License
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <vector>
 #include "../Engine/Game.h"
 #include "../Savegame/Soldier.h"
 #include "../Savegame/SavedGame.h"
@@ -45,6 +46,8 @@ struct SortFunctor
 	{
 		return _getStatFn;
 	}
+	/// Stable sorts the soldiers, getting the stat of each soldier only once.
+	void sort(std::vector<Soldier*> &soldiers) const;
 };
 
 #define GET_ATTRIB_STAT_FN(attrib) \
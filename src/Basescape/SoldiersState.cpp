@@ -315,7 +315,7 @@ void SoldiersState::cbxSortByChange(Action *action)
 			}
 			else
 			{
-				std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+				compFunc->sort(*_base->getSoldiers());
 			}
 			if (_game->isShiftPressed())
 			{
@@ -393,7 +393,7 @@ void SoldiersState::initList(size_t scrl)
 		{
 			for (auto* soldier : *_base->getSoldiers())
 			{
-				if (soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT")
+				if (soldier->getCraft() && soldier->getCraft()->getStatus() == CRAFT_OUT)
 				{
 					// soldiers outside of the base are not eligible
 					continue;
@@ -255,6 +255,128 @@ void TechTreeViewerState::init()
 	}
 }
 
+/**
+ * Gets everything that refers to a research topic (unlocks, requirements, etc.).
+ * All topics are indexed on the first call, so moving around the tree
+ * does not scan the whole mod on every click.
+ * @param rule Research topic.
+ * @return Names of the referring rules.
+ */
+const ResearchUsage &TechTreeViewerState::getResearchUsage(const RuleResearch *rule)
+{
+	if (_researchUsage.empty())
+	{
+		const Mod *mod = _game->getMod();
+		auto byName = [&](const std::string &name) -> ResearchUsage*
+		{
+			const RuleResearch *research = mod->getResearch(name, false);
+			return research ? &_researchUsage[research] : nullptr;
+		};
+
+		for (auto& j : mod->getManufactureList())
+		{
+			RuleManufacture *temp = mod->getManufacture(j);
+			for (auto& i : temp->getRequirements())
+			{
+				_researchUsage[i].requiredByManufacture.push_back(j);
+			}
+		}
+
+		for (auto& f : mod->getBaseFacilitiesList())
+		{
+			RuleBaseFacility *temp = mod->getBaseFacility(f);
+			for (auto& i : temp->getRequirements())
+			{
+				if (ResearchUsage *usage = byName(i))
+				{
+					usage->requiredByFacilities.push_back(f);
+				}
+			}
+		}
+
+		for (auto& item : mod->getItemsList())
+		{
+			RuleItem *temp = mod->getItem(item);
+			for (auto& i : temp->getRequirements())
+			{
+				_researchUsage[i].requiredByItems.push_back(item);
+			}
+			for (auto& i : temp->getBuyRequirements())
+			{
+				_researchUsage[i].requiredByItems.push_back(item);
+			}
+		}
+
+		for (auto& transf : mod->getSoldierTransformationList())
+		{
+			RuleSoldierTransformation* temp = mod->getSoldierTransformation(transf);
+			for (auto& i : temp->getRequiredResearch())
+			{
+				if (ResearchUsage *usage = byName(i))
+				{
+					usage->requiredByTransformations.push_back(transf);
+				}
+			}
+		}
+
+		for (auto& c : mod->getCraftsList())
+		{
+			RuleCraft *temp = mod->getCraft(c);
+			for (auto& i : temp->getRequirements())
+			{
+				if (ResearchUsage *usage = byName(i))
+				{
+					usage->requiredByCrafts.push_back(c);
+				}
+			}
+		}
+
+		for (auto& j : mod->getResearchList())
+		{
+			RuleResearch *temp = mod->getResearch(j);
+			for (auto& i : temp->getUnlocked())
+			{
+				_researchUsage[i].unlockedBy.push_back(j);
+			}
+			for (auto& i : temp->getDisabled())
+			{
+				_researchUsage[i].disabledBy.push_back(j);
+			}
+			for (auto& i : temp->getReenabled())
+			{
+				_researchUsage[i].reenabledBy.push_back(j);
+			}
+			for (auto& i : temp->getGetOneFree())
+			{
+				_researchUsage[i].getForFreeFrom.push_back(j);
+			}
+			for (auto& itMap : temp->getGetOneFreeProtected())
+			{
+				for (auto& i : itMap.second)
+				{
+					_researchUsage[i].getForFreeFrom.push_back(j);
+				}
+			}
+			if (!Mod::isEmptyRuleName(temp->getLookup()))
+			{
+				if (ResearchUsage *usage = byName(temp->getLookup()))
+				{
+					usage->lookupOf.push_back(j);
+				}
+			}
+			for (auto& i : temp->getRequirements())
+			{
+				_researchUsage[i].requiredByResearch.push_back(j);
+			}
+			for (auto& i : temp->getDependencies())
+			{
+				_researchUsage[i].leadsTo.push_back(j);
+			}
+		}
+	}
+	return _researchUsage[rule];
+}
+
 /**
 * Returns to the previous screen.
 * @param action Pointer to an action.
@@ -367,161 +489,28 @@ void TechTreeViewerState::initLists()
 		}
 		//
 
-		const std::vector<std::string> &researchList = _game->getMod()->getResearchList();
-		const std::vector<std::string> &manufactureList = _game->getMod()->getManufactureList();
-
 		// 0. common pre-calculation
 		const std::vector<const RuleResearch*>& reqs = rule->getRequirements();
 		const std::vector<const RuleResearch*>& deps = rule->getDependencies();
-		std::vector<std::string> unlockedBy;
-		std::vector<std::string> disabledBy;
-		std::vector<std::string> reenabledBy;
-		std::vector<std::string> getForFreeFrom;
-		std::vector<std::string> lookupOf;
-		std::vector<std::string> requiredByResearch;
-		std::vector<std::string> requiredByManufacture;
-		std::vector<std::string> requiredByFacilities;
-		std::vector<std::string> requiredByItems;
-		std::vector<std::string> requiredByTransformations;
-		std::vector<std::string> requiredByCrafts;
-		std::vector<std::string> leadsTo;
+		const ResearchUsage &usage = getResearchUsage(rule);
+		const std::vector<std::string> &unlockedBy = usage.unlockedBy;
+		const std::vector<std::string> &disabledBy = usage.disabledBy;
+		const std::vector<std::string> &reenabledBy = usage.reenabledBy;
+		const std::vector<std::string> &getForFreeFrom = usage.getForFreeFrom;
+		const std::vector<std::string> &lookupOf = usage.lookupOf;
+		const std::vector<std::string> &requiredByResearch = usage.requiredByResearch;
+		const std::vector<std::string> &requiredByManufacture = usage.requiredByManufacture;
+		const std::vector<std::string> &requiredByFacilities = usage.requiredByFacilities;
+		const std::vector<std::string> &requiredByItems = usage.requiredByItems;
+		const std::vector<std::string> &requiredByTransformations = usage.requiredByTransformations;
+		const std::vector<std::string> &requiredByCrafts = usage.requiredByCrafts;
+		const std::vector<std::string> &leadsTo = usage.leadsTo;
 		const std::vector<const RuleResearch*>& unlocks = rule->getUnlocked();
 		const std::vector<const RuleResearch*>& disables = rule->getDisabled();
 		const std::vector<const RuleResearch*>& reenables = rule->getReenabled();
 		const std::vector<const RuleResearch*>& free = rule->getGetOneFree();
 		auto& freeProtected = rule->getGetOneFreeProtected();
 
-		for (auto& j : manufactureList)
-		{
-			RuleManufacture *temp = _game->getMod()->getManufacture(j);
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByManufacture.push_back(j);
-				}
-			}
-		}
-
-		for (auto& f : _game->getMod()->getBaseFacilitiesList())
-		{
-			RuleBaseFacility *temp = _game->getMod()->getBaseFacility(f);
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule->getName())
-				{
-					requiredByFacilities.push_back(f);
-				}
-			}
-		}
-
-		for (auto& item : _game->getMod()->getItemsList())
-		{
-			RuleItem *temp = _game->getMod()->getItem(item);
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByItems.push_back(item);
-				}
-			}
-			for (auto& i : temp->getBuyRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByItems.push_back(item);
-				}
-			}
-		}
-
-		for (auto& transf : _game->getMod()->getSoldierTransformationList())
-		{
-			RuleSoldierTransformation* temp = _game->getMod()->getSoldierTransformation(transf);
-			for (auto& i : temp->getRequiredResearch())
-			{
-				if (i == rule->getName())
-				{
-					requiredByTransformations.push_back(transf);
-				}
-			}
-		}
-
-		for (auto& c : _game->getMod()->getCraftsList())
-		{
-			RuleCraft *temp = _game->getMod()->getCraft(c);
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule->getName())
-				{
-					requiredByCrafts.push_back(c);
-				}
-			}
-		}
-
-		for (auto& j : researchList)
-		{
-			RuleResearch *temp = _game->getMod()->getResearch(j);
-			for (auto& i : temp->getUnlocked())
-			{
-				if (i == rule)
-				{
-					unlockedBy.push_back(j);
-				}
-			}
-			for (auto& i : temp->getDisabled())
-			{
-				if (i == rule)
-				{
-					disabledBy.push_back(j);
-				}
-			}
-			for (auto& i : temp->getReenabled())
-			{
-				if (i == rule)
-				{
-					reenabledBy.push_back(j);
-				}
-			}
-			for (auto& i : temp->getGetOneFree())
-			{
-				if (i == rule)
-				{
-					getForFreeFrom.push_back(j);
-				}
-			}
-			for (auto& itMap : temp->getGetOneFreeProtected())
-			{
-				for (auto& i : itMap.second)
-				{
-					if (i == rule)
-					{
-						getForFreeFrom.push_back(j);
-					}
-				}
-			}
-			if (!Mod::isEmptyRuleName(temp->getLookup()))
-			{
-				if (temp->getLookup() == rule->getName())
-				{
-					lookupOf.push_back(j);
-				}
-			}
-			for (auto& i : temp->getRequirements())
-			{
-				if (i == rule)
-				{
-					requiredByResearch.push_back(j);
-				}
-			}
-			for (auto& i : temp->getDependencies())
-			{
-				if (i == rule)
-				{
-					leadsTo.push_back(j);
-				}
-			}
-		}
-
 		// 1. item required
 		if (rule->needItem())
 		{
@@ -21,6 +21,7 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace OpenXcom
@@ -37,6 +38,15 @@ class RuleCraft;
 
 enum TTVMode { TTV_NONE, TTV_RESEARCH, TTV_MANUFACTURING, TTV_FACILITIES, TTV_ITEMS, TTV_CRAFTS };
 
+/**
+ * Everything that refers to one research topic, by name.
+ */
+struct ResearchUsage
+{
+	std::vector<std::string> unlockedBy, disabledBy, reenabledBy, getForFreeFrom, lookupOf, leadsTo;
+	std::vector<std::string> requiredByResearch, requiredByManufacture, requiredByFacilities, requiredByItems, requiredByTransformations, requiredByCrafts;
+};
+
 /**
  * TechTreeViewer screen, where you can browse the Tech Tree.
  */
@@ -56,6 +66,9 @@ private:
 	std::unordered_set<std::string> _disabledResearch;
 	std::unordered_set<std::string> _alreadyAvailableResearch, _alreadyAvailableManufacture, _alreadyAvailableFacilities, _alreadyAvailableCrafts;
 	std::unordered_set<std::string> _protectedItems, _alreadyAvailableItems;
+	std::unordered_map<const RuleResearch*, ResearchUsage> _researchUsage;
+	/// Gets everything that refers to a research topic.
+	const ResearchUsage &getResearchUsage(const RuleResearch *rule);
 	void initLists();
 	void onSelectLeftTopic(Action *action);
 	void onSelectRightTopic(Action *action);
@@ -30,6 +30,7 @@
 #include "../Engine/RNG.h"
 #include "../Engine/Logger.h"
 #include "../Engine/Game.h"
+#include "../Engine/Profiler.h"
 #include "../Mod/Armor.h"
 #include "../Mod/Mod.h"
 #include "../Mod/RuleItem.h"
@@ -38,6 +39,13 @@
 namespace OpenXcom
 {
 
+namespace
+{
+
+/// How far the sweep from the known enemies goes, same as the default limit of a single path search.
+constexpr int KNOWN_ENEMIES_MAX_TU = 1000;
+
+}
 
 /**
  * Sets up a BattleAIState.
@@ -193,12 +201,76 @@ void AIModule::dont_think(BattleAction *action)
 	}
 }
 
+/**
+ * Gets the cost of reaching every tile, leaving enough time units and energy for an action.
+ * @param cost Cost of the action to perform after moving.
+ * @return TU cost for each tile index, -1 for tiles out of reach.
+ */
+std::vector<int> AIModule::findReachableField(const BattleActionCost &cost) const
+{
+	PathfindingCost costMax = { _unit->getTimeUnits() - cost.Time, _unit->getEnergy() - cost.Energy };
+	return _save->getPathfinding()->findDistanceField(_unit, { _unit->getPosition() }, costMax, BAM_NORMAL);
+}
+
+/**
+ * Checks if a tile is in the given reachable field.
+ * @param field Field from findReachableField.
+ * @param pos Position of the tile.
+ * @return True if the tile can be reached.
+ */
+bool AIModule::isReachable(const std::vector<int> &field, Position pos) const
+{
+	const size_t index = _save->getTileIndex(pos);
+	return index < field.size() && field[index] >= 0;
+}
+
+/**
+ * Gets the cost of walking from the nearest known enemy to every tile,
+ * from one sweep starting at all the enemies at once.
+ * Only time units limit the sweep, like the single path searches it replaces.
+ * @param mover Unit whose movement costs are used.
+ * @return TU cost for each tile index, -1 for tiles out of reach, empty when no enemy is known.
+ */
+std::vector<int> AIModule::findKnownEnemiesField(const BattleUnit *mover) const
+{
+	std::vector<Position> starts;
+	for (auto* bu : *_save->getUnits())
+	{
+		if (validTarget(bu, false, false))
+		{
+			starts.push_back(bu->getPosition());
+		}
+	}
+	if (starts.empty())
+	{
+		return {};
+	}
+	return _save->getPathfinding()->findDistanceField(mover, starts, { KNOWN_ENEMIES_MAX_TU, SHRT_MAX }, BAM_NORMAL);
+}
+
+/**
+ * Gets the cost of a tile in the given field.
+ * @param field Field from findReachableField or findKnownEnemiesField.
+ * @param pos Position of the tile, must be on the map.
+ * @param unreached Value for tiles out of reach.
+ * @return The cost.
+ */
+int AIModule::getFieldCost(const std::vector<int> &field, Position pos, int unreached) const
+{
+	const size_t index = _save->getTileIndex(pos);
+	return index < field.size() && field[index] >= 0 ? field[index] : unreached;
+}
+
 /**
  * Runs any code the state needs to keep updating every AI cycle.
  * @param action (possible) AI action to execute after thinking is done.
  */
 void AIModule::think(BattleAction *action)
 {
+	OXCE_PROFILE_SCOPE("AIModule::think");
+	// nothing moves while we are thinking, so step costs can be reused between path searches
+	PathfindingCostCacheScope costCache(_save->getPathfinding());
+
 	action->type = BA_RETHINK;
 	action->actor = _unit;
 	action->weapon = _unit->getMainHandWeapon(false);
@@ -214,7 +286,7 @@ void AIModule::think(BattleAction *action)
 	_melee = (_unit->getUtilityWeapon(BT_MELEE) != 0);
 	_rifle = false;
 	_blaster = false;
-	_reachable = _save->getPathfinding()->findReachable(_unit, BattleActionCost());
+	_reachable = findReachableField(BattleActionCost());
 	_wasHitBy.clear();
 	_foundBaseModuleToDestroy = false;
 
@@ -269,18 +341,18 @@ void AIModule::think(BattleAction *action)
 				if (action->weapon->getCurrentWaypoints() != 0)
 				{
 					_blaster = true;
-					_reachableWithAttack = _save->getPathfinding()->findReachable(_unit, BattleActionCost(BA_AIMEDSHOT, _unit, action->weapon));
+					_reachableWithAttack = findReachableField(BattleActionCost(BA_AIMEDSHOT, _unit, action->weapon));
 				}
 				else
 				{
 					_rifle = true;
-					_reachableWithAttack = _save->getPathfinding()->findReachable(_unit, BattleActionCost(BA_SNAPSHOT, _unit, action->weapon));
+					_reachableWithAttack = findReachableField(BattleActionCost(BA_SNAPSHOT, _unit, action->weapon));
 				}
 			}
 			else if (rule->getBattleType() == BT_MELEE)
 			{
 				_melee = true;
-				_reachableWithAttack = _save->getPathfinding()->findReachable(_unit, BattleActionCost(BA_HIT, _unit, action->weapon));
+				_reachableWithAttack = findReachableField(BattleActionCost(BA_HIT, _unit, action->weapon));
 			}
 		}
 		else
@@ -685,6 +757,7 @@ void AIModule::setupAmbush()
 	int bestScore = 0;
 	_ambushTUs = 0;
 	std::vector<int> path;
+	std::vector<int> enemiesReachable;
 
 	if (selectClosestKnownEnemy())
 	{
@@ -703,7 +776,7 @@ void AIModule::setupAmbush()
 			Position pos = node->getPosition();
 			Tile *tile = _save->getTile(pos);
 			if (tile == 0 || Position::distance2d(pos, _unit->getPosition()) > 10 || pos.z != _unit->getPosition().z || tile->getDangerous() ||
-				std::find(_reachableWithAttack.begin(), _reachableWithAttack.end(), _save->getTileIndex(pos))  == _reachableWithAttack.end())
+				!isReachable(_reachableWithAttack, pos))
 				continue; // just ignore unreachable tiles
 
 			if (_traceAI)
@@ -725,10 +798,13 @@ void AIModule::setupAmbush()
 					int score = BASE_SYSTEMATIC_SUCCESS;
 					score -= ambushTUs;
 
-					// make sure our enemy can reach here too.
-					_save->getPathfinding()->calculate(_aggroTarget, pos, BAM_NORMAL);
+					// make sure the enemies can reach here too, one sweep from all of them covers all candidate tiles.
+					if (enemiesReachable.empty())
+					{
+						enemiesReachable = findKnownEnemiesField(_aggroTarget);
+					}
 
-					if (_save->getPathfinding()->getStartDirection() != -1)
+					if (isReachable(enemiesReachable, pos))
 					{
 						// ideally we'd like to be behind some cover, like say a window or a low wall.
 						if (_save->getTileEngine()->faceWindow(pos) != -1)
@@ -737,7 +813,6 @@ void AIModule::setupAmbush()
 						}
 						if (score > bestScore)
 						{
-							path = _save->getPathfinding()->copyPath();
 							bestScore = score;
 							_ambushTUs = (pos == _unit->getPosition()) ? 1 : ambushTUs;
 							_ambushAction.target = pos;
@@ -753,6 +828,11 @@ void AIModule::setupAmbush()
 
 		if (bestScore > 0)
 		{
+			// the enemy path is only needed for the best tile
+			_save->getPathfinding()->calculate(_aggroTarget, _ambushAction.target, BAM_NORMAL);
+			path = _save->getPathfinding()->copyPath();
+			_save->getPathfinding()->abortPath();
+
 			_ambushAction.type = BA_WALK;
 			// i should really make a function for this
 			origin = _ambushAction.target.toVoxel() +
@@ -896,7 +976,9 @@ void AIModule::setupEscape()
 	selectNearestTarget();
 	_escapeTUs = 0;
 
-	int dist = _aggroTarget ? Position::distance2d(_unit->getPosition(), _aggroTarget->getPosition()) : 0;
+	// distance from the nearest known enemy in walking TUs, one sweep serves all the candidate tiles
+	const std::vector<int> enemiesField = findKnownEnemiesField(_unit);
+	int dist = enemiesField.empty() ? 0 : getFieldCost(enemiesField, _unit->getPosition(), KNOWN_ENEMIES_MAX_TU);
 
 	int bestTileScore = -100000;
 	int score = -100000;
@@ -911,6 +993,8 @@ void AIModule::setupEscape()
 	const int BASE_SYSTEMATIC_SUCCESS = 100;
 	const int BASE_DESPERATE_SUCCESS = 110;
 	const int FAST_PASS_THRESHOLD = 100; // a score that's good enough to quit the while loop early; it's subjective, hand-tuned and may need tweaking
+	const int DISTANCE_WEIGHT = 10; // per tile of distance from the enemies
+	const int TUS_PER_TILE = 4; // walking cost of one tile
 
 	std::vector<Position> randomTileSearch = _save->getTileSearch();
 	RNG::shuffle(randomTileSearch);
@@ -985,14 +1069,14 @@ void AIModule::setupEscape()
 
 		// THINK, DAMN YOU
 		tile = _save->getTile(_escapeAction.target);
-		int distanceFromTarget = _aggroTarget ? Position::distance2d(_aggroTarget->getPosition(), _escapeAction.target) : 0;
+		int distanceFromTarget = (tile && !enemiesField.empty()) ? getFieldCost(enemiesField, _escapeAction.target, KNOWN_ENEMIES_MAX_TU) : dist;
 		if (dist >= distanceFromTarget)
 		{
-			score -= (distanceFromTarget - dist) * 10;
+			score -= (distanceFromTarget - dist) * DISTANCE_WEIGHT / TUS_PER_TILE;
 		}
 		else
 		{
-			score += (distanceFromTarget - dist) * 10;
+			score += (distanceFromTarget - dist) * DISTANCE_WEIGHT / TUS_PER_TILE;
 		}
 		int spotters = 0;
 		if (!tile)
@@ -1002,7 +1086,7 @@ void AIModule::setupEscape()
 		else
 		{
 			spotters = getSpottingUnits(_escapeAction.target);
-			if (std::find(_reachable.begin(), _reachable.end(), _save->getTileIndex(_escapeAction.target))  == _reachable.end())
+			if (!isReachable(_reachable, _escapeAction.target))
 				continue; // just ignore unreachable tiles
 
 			if (_spottingEnemies || spotters)
@@ -1036,29 +1120,36 @@ void AIModule::setupEscape()
 
 		if (tile && score > bestTileScore)
 		{
-			// calculate TUs to tile; we could be getting this from findReachable() somehow but that would break something for sure...
-			_save->getPathfinding()->calculate(_unit, _escapeAction.target, _escapeAction.getMoveType());
-			if (_escapeAction.target == _unit->getPosition() || _save->getPathfinding()->getStartDirection() != -1)
+			// only tiles in the _reachable field get here, so it already has the walking TUs to them
+			bestTileScore = score;
+			bestTile = _escapeAction.target;
+			run = _escapeAction.run;
+			_escapeTUs = getFieldCost(_reachable, _escapeAction.target, 0);
+			if (_escapeAction.target == _unit->getPosition())
 			{
-				bestTileScore = score;
-				bestTile = _escapeAction.target;
-				run = _escapeAction.run;
-				_escapeTUs = _save->getPathfinding()->getTotalTUCost();
-				if (_escapeAction.target == _unit->getPosition())
-				{
-					_escapeTUs = 1;
-				}
-				if (_traceAI)
-				{
-					tile->setMarkerColor(score < 0 ? 7 : (score < FAST_PASS_THRESHOLD/2 ? 10 : (score < FAST_PASS_THRESHOLD ? 4 : 5)));
-					tile->setPreview(10);
-					tile->setTUMarker(score);
-				}
+				_escapeTUs = 1;
+			}
+			if (_traceAI)
+			{
+				tile->setMarkerColor(score < 0 ? 7 : (score < FAST_PASS_THRESHOLD/2 ? 10 : (score < FAST_PASS_THRESHOLD ? 4 : 5)));
+				tile->setPreview(10);
+				tile->setTUMarker(score);
 			}
-			_save->getPathfinding()->abortPath();
 			if (bestTileScore > FAST_PASS_THRESHOLD) coverFound = true; // good enough, gogogo
 		}
 	}
+	if (run && bestTile != _unit->getPosition())
+	{
+		// the field is for walking, check once that the chosen tile can be run to as well
+		_escapeAction.target = bestTile;
+		_escapeAction.run = true;
+		_save->getPathfinding()->calculate(_unit, bestTile, _escapeAction.getMoveType());
+		if (_save->getPathfinding()->getStartDirection() == -1)
+		{
+			run = false;
+		}
+		_save->getPathfinding()->abortPath();
+	}
 	_escapeAction.target = bestTile;
 	_escapeAction.run = run;
 	if (_traceAI)
@@ -1116,12 +1207,16 @@ int AIModule::getSpottingUnits(const Position& pos) const
 	// if we don't actually occupy the position being checked, we need to do a virtual LOF check.
 	bool checking = pos != _unit->getPosition();
 	int tally = 0;
-	for (auto* bu : *_save->getUnits())
-	{
+	// cut by faction and distance on the unit arrays first, only units close enough are visited
+	const auto& hot = _save->getUnitHotState();
+	for (int i = 0; i < hot.size(); ++i)
+	{
+		BattleUnitHandle h{ i };
+		if (hot.getFaction(h) == _unit->getFaction()) continue;
+		if (Position::distance2d(pos, hot.getPosition(h)) > 20) continue;
+		BattleUnit *bu = hot.getUnit(h);
 		if (validTarget(bu, false, false))
 		{
-			int dist = Position::distance2d(pos, bu->getPosition());
-			if (dist > 20) continue;
 			Position originVoxel = _save->getTileEngine()->getSightOriginVoxel(bu);
 			originVoxel.z -= 2;
 			Position targetVoxel;
@@ -1311,7 +1406,7 @@ bool AIModule::selectPointNearTarget(BattleUnit *target, int maxTUs)
 				if (x || y) // skip the unit itself
 				{
 					Position checkPath = target->getPosition() + Position (x, y, z);
-					if (_save->getTile(checkPath) == 0 || std::find(_reachable.begin(), _reachable.end(), _save->getTileIndex(checkPath))  == _reachable.end())
+					if (_save->getTile(checkPath) == 0 || !isReachable(_reachable, checkPath))
 						continue;
 					int dir = _save->getTileEngine()->getDirectionTo(checkPath, target->getPosition());
 					bool valid = _save->getTileEngine()->validMeleeRange(checkPath, dir, _unit, target, 0);
@@ -1834,7 +1929,7 @@ bool AIModule::findFirePoint()
 		Position pos = _unit->getPosition() + randomPosition;
 		Tile *tile = _save->getTile(pos);
 		if (tile == 0  ||
-			std::find(_reachableWithAttack.begin(), _reachableWithAttack.end(), _save->getTileIndex(pos))  == _reachableWithAttack.end())
+			!isReachable(_reachableWithAttack, pos))
 			continue;
 		int score = 0;
 		// i should really make a function for this
@@ -2764,7 +2859,7 @@ void AIModule::selectMeleeOrRanged()
 		{
 			_rifle = false;
 			_attackAction.weapon = melee;
-			_reachableWithAttack = _save->getPathfinding()->findReachable(_unit, BattleActionCost(BA_HIT, _unit, melee));
+			_reachableWithAttack = findReachableField(BattleActionCost(BA_HIT, _unit, melee));
 			return;
 		}
 	}
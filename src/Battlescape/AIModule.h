@@ -51,7 +51,9 @@ private:
 	int _AIMode, _intelligence, _closestDist;
 	Node *_fromNode, *_toNode;
 	bool _foundBaseModuleToDestroy;
-	std::vector<int> _reachable, _reachableWithAttack, _wasHitBy;
+	std::vector<int> _wasHitBy;
+	/// Cost of reaching each tile by index, -1 if the tile is out of reach.
+	std::vector<int> _reachable, _reachableWithAttack;
 	BattleActionType _reserve;
 	UnitFaction _targetFaction;
 
@@ -61,6 +63,14 @@ private:
 	int selectNearestTargetLeeroy(bool canRun);
 	void meleeActionLeeroy(bool canRun);
 	void dont_think(BattleAction *action);
+	/// Gets the cost of reaching every tile with enough time units left for an action.
+	std::vector<int> findReachableField(const BattleActionCost &cost) const;
+	/// Checks if a tile is in the given reachable field.
+	bool isReachable(const std::vector<int> &field, Position pos) const;
+	/// Gets the cost of walking from the nearest known enemy to every tile.
+	std::vector<int> findKnownEnemiesField(const BattleUnit *mover) const;
+	/// Gets the cost of a tile in the given field, or a fallback for tiles out of reach.
+	int getFieldCost(const std::vector<int> &field, Position pos, int unreached) const;
 public:
 	/// Creates a new AIModule linked to the game and a certain unit.
 	AIModule(SavedBattleGame *save, BattleUnit *unit, Node *node);
@@ -39,7 +39,6 @@
 #include "../Savegame/AlienBase.h"
 #include "../Savegame/EquipmentLayoutItem.h"
 #include "../Engine/Game.h"
-#include "../Engine/FileMap.h"
 #include "../Engine/Options.h"
 #include "../Engine/RNG.h"
 #include "../Engine/Exception.h"
@@ -974,9 +973,9 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 	if (!isPreview && _base != 0)
 	{
 		ItemContainer *rememberMe = _save->getBaseStorageItems();
-		for (const auto& pair : *_base->getStorageItems()->getContents())
+		for (const auto& entry : *_base->getStorageItems())
 		{
-			rememberMe->addItem(pair.first, pair.second);
+			rememberMe->addItem(entry.type, entry.qty);
 		}
 	}
 
@@ -1057,7 +1056,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 		for (auto* soldier : *_base->getSoldiers())
 		{
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != CRAFT_OUT)))
 			{
 				Armor* transformedArmor = nullptr;
 				if (enviro)
@@ -1099,7 +1098,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 				continue;
 			}
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != CRAFT_OUT)))
 			{
 				// clear the soldier's equipment layout, we want to start fresh
 				if (_game->getSavedGame()->getDisableSoldierEquipment())
@@ -1160,7 +1159,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 				continue;
 			}
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != CRAFT_OUT)))
 			{
 				// clear the soldier's equipment layout, we want to start fresh
 				if (_game->getSavedGame()->getDisableSoldierEquipment())
@@ -1220,18 +1219,18 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 	if (_craft != 0)
 	{
 		// add items that are in the craft
-		for (const auto& pair : *_craft->getItems()->getContents())
+		for (const auto& entry : _craft->getItems()->getSortedEntries())
 		{
-			if (startingCondition != 0 && !startingCondition->isItemPermitted(pair.first, _game->getMod(), _craft))
+			if (startingCondition != 0 && !startingCondition->isItemPermitted(entry.type, _game->getMod(), _craft))
 			{
 				// send disabled items back to base
-				_base->getStorageItems()->addItem(pair.first, pair.second);
+				_base->getStorageItems()->addItem(entry.type, entry.qty);
 			}
 			else
 			{
-				for (int count = 0; count < pair.second; count++)
+				for (int count = 0; count < entry.qty; count++)
 				{
-					_save->createItemForTile(pair.first, _craftInventoryTile);
+					_save->createItemForTile(entry.type, _craftInventoryTile);
 				}
 			}
 		}
@@ -1242,9 +1241,9 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 		if (_game->getSavedGame()->getMonthsPassed() != -1)
 		{
 			// add items that are in the base
-			for (auto i = _base->getStorageItems()->getContents()->begin(); i != _base->getStorageItems()->getContents()->end();)
+			for (const auto& entry : _base->getStorageItems()->getSortedEntries())
 			{
-				RuleItem *rule = _game->getMod()->getItem(i->first, true);
+				RuleItem *rule = _game->getMod()->getItemByTypeIndex(entry.index, true);
 				if (
 					// is item allowed in base defense?
 					rule->canBeEquippedBeforeBaseDefense() &&
@@ -1256,33 +1255,27 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 					// we know how to use this item
 					_game->getSavedGame()->isResearched(rule->getRequirements()))
 				{
-					for (int count = 0; count < i->second; count++)
+					for (int count = 0; count < entry.qty; count++)
 					{
-						_save->createItemForTile(i->first, _craftInventoryTile);
+						_save->createItemForTile(rule, _craftInventoryTile);
 					}
-					std::map<std::string, int>::iterator tmp = i; // copy
-					++i;
 					if (!_baseInventory)
 					{
-						_base->getStorageItems()->removeItem(tmp->first, tmp->second);
+						_base->getStorageItems()->removeItem(rule, entry.qty);
 					}
 				}
-				else
-				{
-					++i;
-				}
 			}
 		}
 		// add items from crafts in base
 		for (auto* craft : *_base->getCrafts())
 		{
-			if (craft->getStatus() == "STR_OUT")
+			if (craft->getStatus() == CRAFT_OUT)
 				continue;
-			for (const auto& pair : *craft->getItems()->getContents())
+			for (const auto& entry : craft->getItems()->getSortedEntries())
 			{
-				for (int count = 0; count < pair.second; count++)
+				for (int count = 0; count < entry.qty; count++)
 				{
-					_save->createItemForTile(pair.first, _craftInventoryTile);
+					_save->createItemForTile(entry.type, _craftInventoryTile);
 				}
 			}
 		}
@@ -2050,18 +2043,19 @@ int BattlescapeGenerator::loadMAP(MapBlock *mapblock, int xoff, int yoff, int zo
 {
 	int sizex, sizey, sizez;
 	int x = xoff, y = yoff, z = zoff;
-	char size[3];
-	unsigned char value[4];
 	std::string filename = "MAPS/" + mapblock->getName() + ".MAP";
 	unsigned int terrainObjectID;
 
-	// Load file
-	auto mapFile = FileMap::getIStream(filename);
+	// Load file, the block keeps it for next missions
+	const std::vector<char> &mapFile = mapblock->getMapFile();
+	if (mapFile.size() < 3)
+	{
+		throw Exception("Invalid MAP file: " + filename);
+	}
 
-	mapFile->read((char*)&size, sizeof(size));
-	sizey = (int)size[0];
-	sizex = (int)size[1];
-	sizez = (int)size[2];
+	sizey = (int)mapFile[0];
+	sizex = (int)mapFile[1];
+	sizez = (int)mapFile[2];
 
 	mapblock->setSizeZ(sizez);
 
@@ -2111,8 +2105,9 @@ int BattlescapeGenerator::loadMAP(MapBlock *mapblock, int xoff, int yoff, int zo
 		throw Exception("Something is wrong in your map definitions, craft/ufo map is too tall?");
 	}
 
-	while (mapFile->read((char*)&value, sizeof(value)))
+	for (size_t offset = 3; offset + 4 <= mapFile.size(); offset += 4)
 	{
+		const char *value = &mapFile[offset];
 		for (int part = O_FLOOR; part < O_MAX; ++part)
 		{
 			terrainObjectID = ((unsigned char)value[part]);
@@ -2146,11 +2141,6 @@ int BattlescapeGenerator::loadMAP(MapBlock *mapblock, int xoff, int yoff, int zo
 		}
 	}
 
-	if (!mapFile->eof())
-	{
-		throw Exception("Invalid MAP file: " + filename);
-	}
-
 	// Add the craft offset to the positions of the items if we're loading a craft map
 	// But don't do so if loading a verticalLevel, since the z offset of the craft is handled by that code
 	if (craft && zoff == 0)
@@ -2246,16 +2236,17 @@ int BattlescapeGenerator::loadMAP(MapBlock *mapblock, int xoff, int yoff, int zo
  */
 void BattlescapeGenerator::loadRMP(MapBlock *mapblock, int xoff, int yoff, int zoff, int segment)
 {
-	unsigned char value[24];
+	const size_t recordSize = 24;
 	std::string filename = "ROUTES/" + mapblock->getName() +".RMP";
-	// Load file
-	auto mapFile = FileMap::getIStream(filename);
+	// Load file, the block keeps it for next missions
+	const std::vector<char> &routeFile = mapblock->getRouteFile();
 
 	size_t nodeOffset = _save->getNodes()->size();
 	std::vector<int> badNodes;
 	int nodesAdded = 0;
-	while (mapFile->read((char*)&value, sizeof(value)))
+	for (size_t offset = 0; offset + recordSize <= routeFile.size(); offset += recordSize)
 	{
+		const unsigned char *value = (const unsigned char*)&routeFile[offset];
 		int pos_x = value[1];
 		int pos_y = value[0];
 		int pos_z = value[2];
@@ -2323,10 +2314,6 @@ void BattlescapeGenerator::loadRMP(MapBlock *mapblock, int xoff, int yoff, int z
 		}
 	}
 
-	if (!mapFile->eof())
-	{
-		throw Exception("Invalid RMP file: " + filename);
-	}
 }
 
 /**
@@ -2068,7 +2068,7 @@ void DebriefingState::prepareDebriefing()
 			// reequip crafts (only those on the base) after a base defense mission
 			for (auto* xcraft : *base->getCrafts())
 			{
-				if (xcraft->getStatus() != "STR_OUT")
+				if (xcraft->getStatus() != CRAFT_OUT)
 					reequipCraft(base, xcraft, false);
 			}
 		}
@@ -2172,20 +2172,19 @@ void DebriefingState::prepareDebriefing()
  */
 void DebriefingState::reequipCraft(Base *base, Craft *craft, bool vehicleItemsCanBeDestroyed)
 {
-	std::map<std::string, int> craftItemsCopy = *craft->getItems()->getContents();
-	for (const auto& pair : craftItemsCopy)
+	for (const auto& entry : craft->getItems()->getSortedEntries())
 	{
-		int qty = base->getStorageItems()->getItem(pair.first);
-		if (qty >= pair.second)
+		int qty = base->getStorageItems()->getItem(entry.type);
+		if (qty >= entry.qty)
 		{
-			base->getStorageItems()->removeItem(pair.first, pair.second);
+			base->getStorageItems()->removeItem(entry.type, entry.qty);
 		}
 		else
 		{
-			int missing = pair.second - qty;
-			base->getStorageItems()->removeItem(pair.first, qty);
-			craft->getItems()->removeItem(pair.first, missing);
-			ReequipStat stat = {pair.first, missing, craft->getName(_game->getLanguage()), 0};
+			int missing = entry.qty - qty;
+			base->getStorageItems()->removeItem(entry.type, qty);
+			craft->getItems()->removeItem(entry.type, missing);
+			ReequipStat stat = {entry.type, missing, craft->getName(_game->getLanguage()), 0};
 			_missingItems.push_back(stat);
 		}
 	}
@@ -2209,16 +2208,16 @@ void DebriefingState::reequipCraft(Base *base, Craft *craft, bool vehicleItemsCa
 	craft->getVehicles()->clear();
 
 	// Ok, now read those vehicles
-	for (const auto& pair : *craftVehicles.getContents())
+	for (const auto& entry : craftVehicles.getSortedEntries())
 	{
-		int qty = base->getStorageItems()->getItem(pair.first);
-		RuleItem *tankRule = _game->getMod()->getItem(pair.first, true);
+		RuleItem *tankRule = _game->getMod()->getItemByTypeIndex(entry.index, true);
+		int qty = base->getStorageItems()->getItem(tankRule);
 		int size = tankRule->getVehicleUnit()->getArmor()->getTotalSize();
-		int canBeAdded = std::min(qty, pair.second);
-		if (qty < pair.second)
+		int canBeAdded = std::min(qty, entry.qty);
+		if (qty < entry.qty)
 		{ // missing tanks
-			int missing = pair.second - qty;
-			ReequipStat stat = {pair.first, missing, craft->getName(_game->getLanguage()), 0};
+			int missing = entry.qty - qty;
+			ReequipStat stat = {entry.type, missing, craft->getName(_game->getLanguage()), 0};
 			_missingItems.push_back(stat);
 		}
 		if (tankRule->getVehicleClipAmmo() == nullptr)
@@ -2227,7 +2226,7 @@ void DebriefingState::reequipCraft(Base *base, Craft *craft, bool vehicleItemsCa
 			{
 				craft->getVehicles()->push_back(new Vehicle(tankRule, tankRule->getVehicleClipSize(), size));
 			}
-			base->getStorageItems()->removeItem(pair.first, canBeAdded);
+			base->getStorageItems()->removeItem(tankRule, canBeAdded);
 		}
 		else
 		{ // so this tank requires ammo
@@ -2235,9 +2234,9 @@ void DebriefingState::reequipCraft(Base *base, Craft *craft, bool vehicleItemsCa
 			int ammoPerVehicle = tankRule->getVehicleClipsLoaded();
 
 			int baqty = base->getStorageItems()->getItem(ammo); // Ammo Quantity for this vehicle-type on the base
-			if (baqty < pair.second * ammoPerVehicle)
+			if (baqty < entry.qty * ammoPerVehicle)
 			{ // missing ammo
-				int missing = (pair.second * ammoPerVehicle) - baqty;
+				int missing = (entry.qty * ammoPerVehicle) - baqty;
 				ReequipStat stat = {ammo->getType(), missing, craft->getName(_game->getLanguage()), 0};
 				_missingItems.push_back(stat);
 			}
@@ -2249,7 +2248,7 @@ void DebriefingState::reequipCraft(Base *base, Craft *craft, bool vehicleItemsCa
 					craft->getVehicles()->push_back(new Vehicle(tankRule, tankRule->getVehicleClipSize(), size));
 					base->getStorageItems()->removeItem(ammo, ammoPerVehicle);
 				}
-				base->getStorageItems()->removeItem(pair.first, canBeAdded);
+				base->getStorageItems()->removeItem(tankRule, canBeAdded);
 			}
 		}
 	}
@@ -85,7 +85,7 @@ InventoryState::InventoryState(bool tu, BattlescapeState *parent, Base *base, bo
 		for (auto* soldier : *_base->getSoldiers())
 		{
 			_backup[soldier] = soldier->getCraft();
-			if (soldier->getCraft() && soldier->getCraft()->getStatus() != "STR_OUT")
+			if (soldier->getCraft() && soldier->getCraft()->getStatus() != CRAFT_OUT)
 			{
 				soldier->setCraftAndMoveEquipment(0, _base, _game->getSavedGame()->getMonthsPassed() == -1);
 			}
@@ -749,7 +749,7 @@ void InventoryState::btnArmorClick(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (auto soldierIt = _base->getSoldiers()->begin(); soldierIt != _base->getSoldiers()->end(); ++soldierIt)
@@ -787,7 +787,7 @@ void InventoryState::btnArmorClickRight(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == CRAFT_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (auto soldierIt = _base->getSoldiers()->begin(); soldierIt != _base->getSoldiers()->end(); ++soldierIt)
@@ -1074,7 +1074,7 @@ void InventoryState::btnOkClick(Action *)
 			for (auto* soldier : *_base->getSoldiers())
 			{
 				Craft* c = _backup[soldier];
-				if (!soldier->getCraft() && c && c->getStatus() != "STR_OUT")
+				if (!soldier->getCraft() && c && c->getStatus() != CRAFT_OUT)
 				{
 					int space = c->getSpaceAvailable();
 					if (c->validateAddingSoldier(space, soldier))
@@ -1946,7 +1946,7 @@ void InventoryState::onMoveGroundInventoryToBase(Action *)
 	Soldier *s = unit->getGeoscapeSoldier();
 	Craft *c = s->getCraft();
 
-	if (c == 0 || c->getStatus() == "STR_OUT")
+	if (c == 0 || c->getStatus() == CRAFT_OUT)
 	{
 		// we're either not in a craft or not in a hangar (should not happen, but just in case)
 		return;
@@ -70,7 +70,13 @@ Pathfinding::~Pathfinding()
  */
 PathfindingNode *Pathfinding::getNode(Position pos)
 {
-	return &_nodes[_save->getTileIndex(pos)];
+	PathfindingNode *node = &_nodes[_save->getTileIndex(pos)];
+	// nodes left over from previous searches are reset on first use
+	if (node->getGeneration() != _nodesGeneration)
+	{
+		node->reset(_nodesGeneration);
+	}
+	return node;
 }
 
 /**
@@ -187,10 +193,7 @@ void Pathfinding::calculate(BattleUnit *unit, Position endPosition, BattleAction
 bool Pathfinding::aStarPath(Position startPosition, Position endPosition, BattleActionMove bam, const BattleUnit *missileTarget, bool sneak, int maxTUCost)
 {
 	// reset every node, so we have to check them all
-	for (auto& pn : _nodes)
-	{
-		pn.reset();
-	}
+	resetNodes();
 
 	// start position is the first one in our "open" list
 	PathfindingNode *start = getNode(startPosition);
@@ -219,7 +222,7 @@ bool Pathfinding::aStarPath(Position startPosition, Position endPosition, Battle
 		// Try all reachable neighbours.
 		for (int direction = 0; direction < 10; direction++)
 		{
-			PathfindingStep r = getTUCost(currentPos, direction, _unit, missileTarget, bam);
+			PathfindingStep r = getCachedTUCost(currentPos, direction, _unit, missileTarget, bam);
 			if (r.cost.time == INVALID_MOVE_COST) // Skip unreachable / blocked
 				continue;
 
@@ -718,6 +721,72 @@ PathfindingStep Pathfinding::getTUCost(Position startPosition, int direction, co
 	return { { Clamp(timeCost, 1, INVALID_MOVE_COST - 1), Clamp(energyCost, 0, INVALID_MOVE_COST) }, { firePenaltyCost, 0 }, pos };
 }
 
+/**
+ * Gets the TU cost of one step, same as getTUCost.
+ * While the cost cache is enabled, results are remembered per start tile and direction
+ * and reused as long as the same unit moves the same way.
+ * @param startPosition The position to start from.
+ * @param direction The direction we are facing.
+ * @param unit The unit moving.
+ * @param missileTarget The target unit used for BAM_MISSILE.
+ * @param bam What move type is required.
+ * @return TU cost or 255 if movement is impossible.
+ */
+PathfindingStep Pathfinding::getCachedTUCost(Position startPosition, int direction, const BattleUnit *unit, const BattleUnit *missileTarget, BattleActionMove bam)
+{
+	// strafing depends on the unit facing, so it is not worth caching
+	if (_costCacheDepth == 0 || bam == BAM_STRAFE)
+	{
+		return getTUCost(startPosition, direction, unit, missileTarget, bam);
+	}
+
+	if (unit != _costCacheUnit || missileTarget != _costCacheMissileTarget || (int)bam != _costCacheMove)
+	{
+		_costCacheUnit = unit;
+		_costCacheMissileTarget = missileTarget;
+		_costCacheMove = bam;
+		++_costCacheCurrent;
+	}
+
+	const int index = _save->getTileIndex(startPosition) * dir_max + direction;
+	if (_costCacheStamp[index] != _costCacheCurrent)
+	{
+		_costCache[index] = getTUCost(startPosition, direction, unit, missileTarget, bam);
+		_costCacheStamp[index] = _costCacheCurrent;
+	}
+	return _costCache[index];
+}
+
+/**
+ * Starts caching step costs.
+ * Until the matching stopCostCache call, nothing on the battlefield
+ * (terrain, doors, units, spotting) may change, as cached costs are not revalidated.
+ */
+void Pathfinding::startCostCache()
+{
+	if (_costCacheDepth++ == 0)
+	{
+		if (_costCache.empty())
+		{
+			_costCache.resize(_size * dir_max);
+			_costCacheStamp.resize(_size * dir_max, 0);
+		}
+		// everything cached before could be outdated now
+		_costCacheUnit = nullptr;
+		_costCacheMissileTarget = nullptr;
+		_costCacheMove = -1;
+		++_costCacheCurrent;
+	}
+}
+
+/**
+ * Stops caching step costs.
+ */
+void Pathfinding::stopCostCache()
+{
+	--_costCacheDepth;
+}
+
 /**
  * Checks whether a path is ready and gives the first direction.
  * @return Direction where the unit needs to go next, -1 if it's the end of the path.
@@ -1365,7 +1434,7 @@ bool Pathfinding::bresenhamPath(Position origin, Position target, BattleActionMo
 					dir = DIR_DOWN;
 				}
 			}
-			PathfindingStep r = getTUCost(lastPoint, dir, _unit, missileTarget, bam);
+			PathfindingStep r = getCachedTUCost(lastPoint, dir, _unit, missileTarget, bam);
 			nextPoint = r.pos;
 			int tuCost = r.cost.time + r.penalty.time;
 
@@ -1414,29 +1483,31 @@ bool Pathfinding::bresenhamPath(Position origin, Position target, BattleActionMo
 }
 
 /**
- * Locates all tiles reachable to @a *unit with a TU cost no more than @a tuMax.
- * Uses Dijkstra's algorithm.
- * @param unit Pointer to the unit.
- * @param tuMax The maximum cost of the path to each tile.
- * @return An array of reachable tiles, sorted in ascending order of cost. The first tile is the start location.
+ * Visits all tiles reachable from any of the start positions with a cost no more than @a costMax.
+ * Uses Dijkstra's algorithm, so one sweep serves any number of start positions.
+ * @param unit Pointer to the moving unit.
+ * @param starts Start positions.
+ * @param costMax The maximum cost of the path to each tile.
+ * @param bam Move type.
+ * @param visited Nodes of the reached tiles, in the order they were finished.
  */
-std::vector<int> Pathfinding::findReachable(const BattleUnit *unit, const BattleActionCost &cost)
+void Pathfinding::sweepReachable(const BattleUnit *unit, const std::vector<Position> &starts, PathfindingCost costMax, BattleActionMove bam, std::vector<PathfindingNode*> &visited)
 {
-	const Position start = unit->getPosition();
-	int tuMax = unit->getTimeUnits() - cost.Time;
-	int energyMax = unit->getEnergy() - cost.Energy;
-
-	PathfindingCost costMax = { tuMax, energyMax };
-
-	for (auto& pn : _nodes)
+	resetNodes();
+	PathfindingOpenSet unvisited;
+	for (const auto& start : starts)
 	{
-		pn.reset();
+		if (!_save->getTile(start))
+		{
+			continue;
+		}
+		PathfindingNode *startNode = getNode(start);
+		if (!startNode->inOpenSet())
+		{
+			startNode->connect({}, 0, 0);
+			unvisited.push(startNode);
+		}
 	}
-	PathfindingNode *startNode = getNode(start);
-	startNode->connect({}, 0, 0);
-	PathfindingOpenSet unvisited;
-	unvisited.push(startNode);
-	std::vector<PathfindingNode*> reachable;
 	while (!unvisited.empty())
 	{
 		PathfindingNode *currentNode = unvisited.pop();
@@ -1445,7 +1516,7 @@ std::vector<int> Pathfinding::findReachable(const BattleUnit *unit, const Battle
 		// Try all reachable neighbours.
 		for (int direction = 0; direction < 10; direction++)
 		{
-			PathfindingStep r = getTUCost(currentPos, direction, unit, 0, BAM_NORMAL);
+			PathfindingStep r = getCachedTUCost(currentPos, direction, unit, 0, bam);
 			if (r.cost.time == INVALID_MOVE_COST) // Skip unreachable / blocked
 				continue;
 			PathfindingCost totalTuCost = currentNode->getTUCost(false) + r.cost + r.penalty;
@@ -1462,16 +1533,31 @@ std::vector<int> Pathfinding::findReachable(const BattleUnit *unit, const Battle
 			}
 		}
 		currentNode->setChecked();
-		reachable.push_back(currentNode);
+		visited.push_back(currentNode);
 	}
-	std::sort(reachable.begin(), reachable.end(), MinNodeCosts());
-	std::vector<int> tiles;
-	tiles.reserve(reachable.size());
+}
+
+/**
+ * Calculates how much it costs @a *unit to reach every tile,
+ * starting from whichever of the start positions is the closest.
+ * Useful for questions like "how far is this tile from any of the enemies"
+ * without running a separate search per enemy and per tile.
+ * @param unit Pointer to the moving unit.
+ * @param starts Start positions.
+ * @param costMax The maximum cost of the path to each tile.
+ * @param bam Move type.
+ * @return TU cost for each tile index, -1 for tiles that can't be reached.
+ */
+std::vector<int> Pathfinding::findDistanceField(const BattleUnit *unit, const std::vector<Position> &starts, PathfindingCost costMax, BattleActionMove bam)
+{
+	std::vector<PathfindingNode*> reachable;
+	sweepReachable(unit, starts, costMax, bam, reachable);
+	std::vector<int> field(_size, -1);
 	for (auto* pn : reachable)
 	{
-		tiles.push_back(_save->getTileIndex(pn->getPosition()));
+		field[_save->getTileIndex(pn->getPosition())] = pn->getTUCost(false).time;
 	}
-	return tiles;
+	return field;
 }
 
 /**
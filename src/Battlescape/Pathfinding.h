@@ -46,6 +46,7 @@ private:
 
 	SavedBattleGame *_save;
 	std::vector<PathfindingNode> _nodes;
+	int _nodesGeneration = 0;
 	int _size;
 	BattleUnit *_unit;
 	bool _pathPreviewed;
@@ -53,9 +54,22 @@ private:
 	bool _ctrlUsed = false;
 	bool _altUsed = false;
 	PathfindingCost _totalTUCost;
+	std::vector<PathfindingStep> _costCache;
+	std::vector<int> _costCacheStamp;
+	int _costCacheCurrent = 0;
+	int _costCacheDepth = 0;
+	const BattleUnit *_costCacheUnit = nullptr;
+	const BattleUnit *_costCacheMissileTarget = nullptr;
+	int _costCacheMove = -1;
 
 	/// Gets the node at certain position.
 	PathfindingNode *getNode(Position pos);
+	/// Resets all nodes before a new search.
+	void resetNodes() { ++_nodesGeneration; }
+	/// Visits all tiles reachable from the start positions, in order of cost.
+	void sweepReachable(const BattleUnit *unit, const std::vector<Position> &starts, PathfindingCost costMax, BattleActionMove bam, std::vector<PathfindingNode*> &visited);
+	/// Gets the TU cost of one step, reusing it from the cost cache if possible.
+	PathfindingStep getCachedTUCost(Position startPosition, int direction, const BattleUnit *unit, const BattleUnit *missileTarget, BattleActionMove bam);
 
 	/// Gets movement type of unit or movement of missile.
 	MovementType getMovementType(const BattleUnit *unit, const BattleUnit *missileTarget, BattleActionMove bam) const;
@@ -249,6 +263,10 @@ public:
 	int dequeuePath();
 	/// Gets the TU cost to move from 1 tile to the other.
 	PathfindingStep getTUCost(Position startPosition, int direction, const BattleUnit *unit, const BattleUnit *missileTarget, BattleActionMove bam) const;
+	/// Starts caching step costs, the battle must not change until it is stopped.
+	void startCostCache();
+	/// Stops caching step costs.
+	void stopCostCache();
 	/// Aborts the current path.
 	void abortPath();
 	/// Gets the strafe move setting.
@@ -265,8 +283,8 @@ public:
 
 	/// Sets _unit in order to abuse low-level pathfinding functions from outside the class.
 	void setUnit(BattleUnit *unit);
-	/// Gets all reachable tiles, based on cost.
-	std::vector<int> findReachable(const BattleUnit *unit, const BattleActionCost &cost);
+	/// Gets the cost of reaching every tile from the nearest of the start positions.
+	std::vector<int> findDistanceField(const BattleUnit *unit, const std::vector<Position> &starts, PathfindingCost costMax, BattleActionMove bam);
 	/// Gets _totalTUCost; finds out whether we can hike somewhere in this turn or not.
 	int getTotalTUCost() const { return _totalTUCost.time; }
 	/// Gets the path preview setting.
@@ -281,4 +299,20 @@ public:
 	std::vector<int> copyPath() const;
 };
 
+/**
+ * Keeps the step cost cache of the pathfinding enabled while in scope.
+ */
+class PathfindingCostCacheScope
+{
+	Pathfinding *_pathfinding;
+public:
+	/// Starts caching step costs.
+	PathfindingCostCacheScope(Pathfinding *pathfinding) : _pathfinding(pathfinding) { _pathfinding->startCostCache(); }
+	/// Stops caching step costs.
+	~PathfindingCostCacheScope() { _pathfinding->stopCostCache(); }
+
+	PathfindingCostCacheScope(const PathfindingCostCacheScope&) = delete;
+	PathfindingCostCacheScope& operator=(const PathfindingCostCacheScope&) = delete;
+};
+
 }
@@ -25,7 +25,7 @@ namespace OpenXcom
  * Sets up a PathfindingNode.
  * @param pos Position.
  */
-PathfindingNode::PathfindingNode(Position pos) : _pos(pos), _prevNode(0), _prevDir(0), _tuGuess(0), _checked(0), _openentry(0)
+PathfindingNode::PathfindingNode(Position pos) : _pos(pos), _prevNode(0), _prevDir(0), _tuGuess(0), _checked(0), _openentry(0), _generation(0)
 {
 
 }
@@ -49,11 +49,13 @@ Position PathfindingNode::getPosition() const
 
 /**
  * Resets the node.
+ * @param generation Search the node is now used by.
  */
-void PathfindingNode::reset()
+void PathfindingNode::reset(int generation)
 {
 	_checked = false;
 	_openentry = 0;
+	_generation = generation;
 }
 
 /**
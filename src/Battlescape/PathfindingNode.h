@@ -95,6 +95,8 @@ private:
 	bool _checked;
 	// Invasive field needed by PathfindingOpenSet
 	Uint8 _openentry;
+	/// Search this node state belongs to.
+	int _generation;
 	friend class PathfindingOpenSet;
 public:
 	/// Creates a new PathfindingNode class.
@@ -103,8 +105,10 @@ public:
 	~PathfindingNode();
 	/// Gets the node position.
 	Position getPosition() const;
-	/// Resets the node.
-	void reset();
+	/// Resets the node for a new search.
+	void reset(int generation);
+	/// Gets the search this node state belongs to.
+	int getGeneration() const { return _generation; }
 	/// Is checked?
 	bool isChecked() const;
 	/// Marks the node as checked.
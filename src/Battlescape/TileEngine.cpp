@@ -17,6 +17,7 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <assert.h>
+#include <algorithm>
 #include <set>
 #include "TileEngine.h"
 #include "AIModule.h"
@@ -40,6 +41,7 @@
 #include "../Mod/RuleSkill.h"
 #include "Pathfinding.h"
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
 #include "ProjectileFlyBState.h"
 #include "MeleeAttackBState.h"
 #include "../fmath.h"
@@ -283,6 +285,78 @@ constexpr static Uint32 MaskSmoke =  selectBit(+7, +1) << 2;
 
 
 
+namespace
+{
+
+/**
+ * Tile offsets visited by the explosion rays, one ray per step of the `fi` and `te` angles.
+ * They do not depend on where the explosion is, so every ray is extended lazily only as far as some explosion needed it.
+ * Offsets are kept unrounded, rounding them together with the center keeps the exact results of calculating them in place.
+ */
+class ExplosionRayTable
+{
+	struct Step
+	{
+		double x, y, z;
+	};
+
+	std::vector<double> _sinTe, _cosTe, _sinFi, _cosFi;
+	std::vector<std::vector<Step>> _steps;
+
+public:
+	static constexpr int FiStep = 5;
+	static constexpr int TeStep = 3;
+	static constexpr int FiCount = 180 / FiStep + 1;
+	static constexpr int TeCount = 360 / TeStep + 1;
+
+	/// Calculates the directions of all rays.
+	ExplosionRayTable() : _sinTe(FiCount * TeCount), _cosTe(FiCount * TeCount), _sinFi(FiCount * TeCount), _cosFi(FiCount * TeCount), _steps(FiCount * TeCount)
+	{
+		for (int f = 0; f < FiCount; ++f)
+		{
+			const int fi = -90 + f * FiStep;
+			for (int t = 0; t < TeCount; ++t)
+			{
+				const int te = t * TeStep;
+				const int ray = f * TeCount + t;
+				_sinTe[ray] = sin(Deg2Rad(te));
+				_cosTe[ray] = cos(Deg2Rad(te));
+				_sinFi[ray] = sin(Deg2Rad(fi));
+				_cosFi[ray] = cos(Deg2Rad(fi));
+			}
+		}
+	}
+
+	/// Gets the tile of step `l` (starting from 1) of the given ray from the explosion center.
+	Position getStep(int ray, int l, Position center)
+	{
+		auto& steps = _steps[ray];
+		while ((int)steps.size() < l)
+		{
+			const int d = steps.size() + 1;
+			steps.push_back(Step{
+				d * _sinTe[ray] * _cosFi[ray],
+				d * _cosTe[ray] * _cosFi[ray],
+				d * _sinFi[ray]
+			});
+		}
+		const Step& step = steps[l - 1];
+		return Position(
+			int(floor(center.x + 0.5 + step.x)),
+			int(floor(center.y + 0.5 + step.y)),
+			int(floor(center.z + 0.5 + step.z))
+		);
+	}
+};
+
+ExplosionRayTable &getExplosionRays()
+{
+	static ExplosionRayTable table;
+	return table;
+}
+
+} // namespace
+
 template<typename T>
 Uint32 getBlockDir(const T& td)
 {
@@ -903,6 +977,7 @@ TileEngine::TileEngine(SavedBattleGame *save, Mod *mod) :
 	_blockVisibility.resize(save->getMapSizeXYZ());
 	_lightPropagationTerrainBlocking.resize(save->getMapSizeXYZ());
 	_lightPropagationTempNeedUpdate.resize(save->getMapSizeXYZ());
+	_explosionTileDamage.resize(save->getMapSizeXYZ(), -1);
 	_cacheTilePos = invalid;
 
 	if (Options::oxceTogglePersonalLightType == 2)
@@ -1121,6 +1196,7 @@ void TileEngine::calculateUnitLighting(MapSubset gs)
 
 void TileEngine::calculateLighting(LightLayers layer, Position position, int eventRadius, bool terrianChanged)
 {
+	OXCE_PROFILE_SCOPE("TileEngine::calculateLighting");
 	const auto gsMap = MapSubset{ _save->getMapSizeX(), _save->getMapSizeY() };
 	auto gsDynamic = gsMap;
 	auto gsStatic = gsDynamic;
@@ -1666,6 +1742,7 @@ void TileEngine::calculateTilesInFOV(BattleUnit *unit, const Position eventPos,
 */
 bool TileEngine::calculateFOV(BattleUnit *unit, bool doTileRecalc, bool doUnitRecalc)
 {
+	OXCE_PROFILE_SCOPE("TileEngine::calculateFOV");
 	//Force a full FOV recheck for this unit.
 	if (doTileRecalc) calculateTilesInFOV(unit);
 	return doUnitRecalc ? calculateUnitsInFOV(unit) : false;
@@ -1836,11 +1913,56 @@ std::tuple<int, int, int, int, int> getTrajectoryDataHelper(TileEngine* te, cons
 
 /**
  * Checks for an opposing unit on this tile.
+ * While the visibility cache is enabled, a repeated check of the same unit and tile reuses the previous result.
  * @param currentUnit The watcher.
  * @param tile The tile to check for
  * @return True if visible.
  */
 bool TileEngine::visible(BattleUnit *currentUnit, Tile *tile)
+{
+	if (_visibilityCacheDepth == 0)
+	{
+		return calculateVisible(currentUnit, tile);
+	}
+	const Uint64 key = ((Uint64)(Uint32)currentUnit->getId() << 32) | (Uint32)_save->getTileIndex(tile->getPosition());
+	auto it = _visibilityCache.find(key);
+	if (it != _visibilityCache.end())
+	{
+		return it->second;
+	}
+	const bool result = calculateVisible(currentUnit, tile);
+	_visibilityCache.emplace(key, result);
+	return result;
+}
+
+/**
+ * Starts caching visibility checks.
+ * Until the matching stopVisibilityCache call, nothing that affects visibility
+ * (units, terrain, smoke, fire, lighting) may change, as cached results are not revalidated.
+ */
+void TileEngine::startVisibilityCache()
+{
+	if (_visibilityCacheDepth++ == 0)
+	{
+		_visibilityCache.clear();
+	}
+}
+
+/**
+ * Stops caching visibility checks.
+ */
+void TileEngine::stopVisibilityCache()
+{
+	--_visibilityCacheDepth;
+}
+
+/**
+ * Checks for an opposing unit on this tile, without looking at the visibility cache.
+ * @param currentUnit The watcher.
+ * @param tile The tile to check for
+ * @return True if visible.
+ */
+bool TileEngine::calculateVisible(BattleUnit *currentUnit, Tile *tile)
 {
 	// if there is no tile or no unit, we can't see it
 	if (!tile || !tile->getUnit())
@@ -2449,6 +2571,7 @@ bool TileEngine::canTargetTile(Position *originVoxel, Tile *tile, int part, Posi
  */
 void TileEngine::calculateFOV(Position position, int eventRadius, const bool updateTiles, const bool appendToTileVisibility)
 {
+	OXCE_PROFILE_SCOPE("TileEngine::calculateFOV");
 	int updateRadius;
 	if (eventRadius == -1)
 	{
@@ -2549,10 +2672,14 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 	// no reaction on civilian turn.
 	if (_save->getSide() != FACTION_NEUTRAL)
 	{
+		const Position unitPosition = unit->getPosition();
+		const int maxViewDistanceSq = getMaxViewDistanceSq();
 		for (auto* bu : *_save->getUnits())
 		{
+				// closer than 20 tiles, checked first as it rules out most of the units on big maps
+			if (Position::distance2dSq(unitPosition, bu->getPosition()) <= maxViewDistanceSq &&
 				// not dead/unconscious
-			if (!bu->isOut() &&
+				!bu->isOut() &&
 				// not dying or not about to pass out
 				!bu->isOutThresholdExceed() &&
 				// have any chances for reacting
@@ -2560,16 +2687,8 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 				// not a friend
 				bu->getFaction() != _save->getSide() &&
 				// not a civilian, or a civilian shooting at bad non-ignored guys
-				(bu->getFaction() != FACTION_NEUTRAL || (unit->getFaction() == FACTION_HOSTILE && !unit->isIgnoredByAI())) &&
-				// closer than 20 tiles
-				Position::distance2dSq(unit->getPosition(), bu->getPosition()) <= getMaxViewDistanceSq())
+				(bu->getFaction() != FACTION_NEUTRAL || (unit->getFaction() == FACTION_HOSTILE && !unit->isIgnoredByAI())))
 			{
-				BattleAction falseAction;
-				falseAction.type = BA_SNAPSHOT;
-				falseAction.actor = bu;
-				falseAction.target = unit->getPosition();
-				Position originVoxel = getOriginVoxel(falseAction, 0);
-				Position targetVoxel;
 				AIModule *ai = bu->getAIModule();
 
 				// Inquisitor's note regarding 'gotHit' variable
@@ -2595,12 +2714,23 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 					gotHit = bu->wasMeleeAttackedBy(unit->getId());
 				}
 
-					// can actually see the target Tile, or we got hit
-				if ((bu->checkViewSector(unit->getPosition()) || gotHit) &&
+				// can actually see the target Tile, or we got hit
+				if (!bu->checkViewSector(unit->getPosition()) && !gotHit)
+				{
+					continue;
+				}
+
+				BattleAction falseAction;
+				falseAction.type = BA_SNAPSHOT;
+				falseAction.actor = bu;
+				falseAction.target = unit->getPosition();
+				Position originVoxel = getOriginVoxel(falseAction, 0);
+				Position targetVoxel;
+
+					// can actually see the unit (usually already checked by the FOV update of this step)
+				if (visible(bu, tile) &&
 					// can actually target the unit
-					canTargetUnit(&originVoxel, tile, &targetVoxel, bu, false) &&
-					// can actually see the unit
-					visible(bu, tile))
+					canTargetUnit(&originVoxel, tile, &targetVoxel, bu, false))
 				{
 					if (bu->getFaction() == FACTION_PLAYER)
 					{
@@ -3291,9 +3421,10 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 	int hitSide = 0;
 	int diagonalWall = 0;
 	int power_;
-	std::map<Tile*, int> tilesAffected;
+	std::vector<int> &tileDamage = _explosionTileDamage;
+	std::vector<Tile*> tilesAffected;
 	std::vector<BattleItem*> toRemove;
-	std::pair<std::map<Tile*, int>::iterator, bool> ret;
+	ExplosionRayTable &rays = getExplosionRays();
 
 	if (type->FireBlastCalc)
 	{
@@ -3326,33 +3457,36 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 			hitSide = (center.x % 16 + center.y % 16 - 15) > 0 ? 1 : -1;
 	}
 
-	for (int fi = -90; fi <= 90; fi += 5)
+	for (int f = 0; f < ExplosionRayTable::FiCount; ++f)
 	{
 		// raytrace every 3 degrees makes sure we cover all tiles in a circle.
-		for (int te = 0; te <= 360; te += 3)
+		for (int t = 0; t < ExplosionRayTable::TeCount; ++t)
 		{
-			double cos_te = cos(Deg2Rad(te));
-			double sin_te = sin(Deg2Rad(te));
-			double sin_fi = sin(Deg2Rad(fi));
-			double cos_fi = cos(Deg2Rad(fi));
+			const int te = t * ExplosionRayTable::TeStep;
+			const int ray = f * ExplosionRayTable::TeCount + t;
 
 			origin = _save->getTile(centetTile);
 			dest = origin;
-			double l = 0;
-			int tileX, tileY, tileZ;
+			int l = 0;
 			power_ = power;
 			while (power_ > 0 && l <= maxRadius)
 			{
 				if (power_ > 0)
 				{
-					ret = tilesAffected.insert(std::make_pair(dest, 0)); // check if we had this tile already affected
+					int &damageDone = tileDamage[_save->getTileIndex(dest->getPosition())];
+					const bool firstHit = damageDone < 0; // check if we had this tile already affected
+					if (firstHit)
+					{
+						damageDone = 0;
+						tilesAffected.push_back(dest);
+					}
 
 					const int tileDmg = type->getTileFinalDamage(power_);
-					if (tileDmg > ret.first->second)
+					if (tileDmg > damageDone)
 					{
-						ret.first->second = tileDmg;
+						damageDone = tileDmg;
 					}
-					if (ret.second)
+					if (firstHit)
 					{
 						const int damage = type->getRandomDamage(power_);
 						BattleUnit *bu = dest->getOverlappingUnit(_save);
@@ -3408,20 +3542,16 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 					}
 				}
 
-				l += 1.0;
-
-				tileX = int(floor(centetTile.x + 0.5 + l * sin_te * cos_fi));
-				tileY = int(floor(centetTile.y + 0.5 + l * cos_te * cos_fi));
-				tileZ = int(floor(centetTile.z + 0.5 + l * sin_fi));
+				l += 1;
 
 				origin = dest;
-				dest = _save->getTile(Position(tileX, tileY, tileZ));
+				dest = _save->getTile(rays.getStep(ray, l, centetTile));
 
 				if (!dest) break; // out of map!
 
 				// blockage by terrain is deducted from the explosion power
 				power_ -= type->RadiusReduction; // explosive damage decreases by 10 per tile
-				if (origin->getPosition().z != tileZ)
+				if (origin->getPosition().z != dest->getPosition().z)
 					power_ -= vertdec; //3d explosion factor
 
 				if (type->FireBlastCalc)
@@ -3430,33 +3560,31 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 					Pathfinding::vectorToDirection(origin->getPosition() - dest->getPosition(), dir);
 					if (dir != -1 && dir %2) power_ -= 0.5f * type->RadiusReduction; // diagonal movement costs an extra 50% for fire.
 				}
-				if (l > 0.5) {
-					if ( l > 1.5)
+				if (l > 1)
+				{
+					power_ -= verticalBlockage(origin, dest, type->ResistType, false) * 2;
+					power_ -= horizontalBlockage(origin, dest, type->ResistType, false) * 2;
+				}
+				else //tricky bigwall deflection /Volutar
+				{
+					bool skipObject = diagonalWall == 0;
+					if (diagonalWall == Pathfinding::BIGWALLNESW) // --
 					{
-						power_ -= verticalBlockage(origin, dest, type->ResistType, false) * 2;
-						power_ -= horizontalBlockage(origin, dest, type->ResistType, false) * 2;
+						if (hitSide<0 && te >= 135 && te < 315)
+							skipObject = true;
+						if (hitSide>0 && ( te < 135 || te > 315))
+							skipObject = true;
 					}
-					else //tricky bigwall deflection /Volutar
+					if (diagonalWall == Pathfinding::BIGWALLNWSE) // |
 					{
-						bool skipObject = diagonalWall == 0;
-						if (diagonalWall == Pathfinding::BIGWALLNESW) // --
-						{
-							if (hitSide<0 && te >= 135 && te < 315)
-								skipObject = true;
-							if (hitSide>0 && ( te < 135 || te > 315))
-								skipObject = true;
-						}
-						if (diagonalWall == Pathfinding::BIGWALLNWSE) // |
-						{
-							if (hitSide>0 && te >= 45 && te < 225)
-								skipObject = true;
-							if (hitSide<0 && ( te < 45 || te > 225))
-								skipObject = true;
-						}
-						power_ -= verticalBlockage(origin, dest, type->ResistType, skipObject) * 2;
-						power_ -= horizontalBlockage(origin, dest, type->ResistType, skipObject) * 2;
-
+						if (hitSide>0 && te >= 45 && te < 225)
+							skipObject = true;
+						if (hitSide<0 && ( te < 45 || te > 225))
+							skipObject = true;
 					}
+					power_ -= verticalBlockage(origin, dest, type->ResistType, skipObject) * 2;
+					power_ -= horizontalBlockage(origin, dest, type->ResistType, skipObject) * 2;
+
 				}
 			}
 		}
@@ -3465,18 +3593,24 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 	// now detonate the tiles affected by explosion
 	if (type->ToTile > 0.0f)
 	{
-		for (auto& pair : tilesAffected)
+		// tiles are stored in one array, detonate them in map order
+		std::sort(tilesAffected.begin(), tilesAffected.end());
+		for (auto* tile : tilesAffected)
 		{
-			if (detonate(pair.first, pair.second))
+			if (detonate(tile, tileDamage[_save->getTileIndex(tile->getPosition())]))
 			{
 				_save->addDestroyedObjective();
 			}
-			applyGravity(pair.first);
-			Tile *j = _save->getTile(pair.first->getPosition() + Position(0,0,1));
+			applyGravity(tile);
+			Tile *j = _save->getTile(tile->getPosition() + Position(0,0,1));
 			if (j)
 				applyGravity(j);
 		}
 	}
+	for (auto* tile : tilesAffected)
+	{
+		tileDamage[_save->getTileIndex(tile->getPosition())] = -1;
+	}
 	calculateLighting(LL_AMBIENT, centetTile, maxRadius + 1, true); // roofs could have been destroyed and fires could have been started
 	calculateFOV(centetTile, maxRadius + 1, true, true);
 	if (attack.attacker && Position::distance2d(centetTile, attack.attacker->getPosition()) > maxRadius + 1)
@@ -18,6 +18,7 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <vector>
+#include <unordered_map>
 #include "Position.h"
 #include "BattlescapeGame.h"
 #include "../Mod/RuleItem.h"
@@ -111,6 +112,8 @@ private:
 	std::vector<Uint32> _lightPropagationTerrainBlocking;
 	/// Cache for marking tiles that need light updated.
 	std::vector<Uint32> _lightPropagationTempNeedUpdate;
+	/// Highest explosion damage per tile, -1 for tiles not reached by the current explosion.
+	std::vector<int> _explosionTileDamage;
 
 	const RuleInventory *_inventorySlotGround;
 	constexpr static int heightFromCenter[11] = {0,-2,+2,-4,+4,-6,+6,-8,+8,-12,+12};
@@ -129,6 +132,13 @@ private:
 	std::vector<BattleUnit*> _movingUnitPrev;
 	BattleUnit* _movingUnit = nullptr;
 
+	/// Results of visibility checks done while the visibility cache was enabled, keyed by unit id and tile index.
+	std::unordered_map<Uint64, bool> _visibilityCache;
+	int _visibilityCacheDepth = 0;
+
+	/// Checks visibility of a unit on this tile, ignoring the visibility cache.
+	bool calculateVisible(BattleUnit *currentUnit, Tile *tile);
+
 	/// Add light source.
 	void addLight(MapSubset gs, Position center, int power, LightLayers layer);
 	/// Calculate blockage amount.
@@ -213,6 +223,10 @@ public:
 	Position getSightOriginVoxel(BattleUnit *currentUnit);
 	/// Checks visibility of a unit on this tile.
 	bool visible(BattleUnit *currentUnit, Tile *tile);
+	/// Starts reusing the results of visibility checks.
+	void startVisibilityCache();
+	/// Stops reusing the results of visibility checks.
+	void stopVisibilityCache();
 	/// Checks visibility of a tile.
 	bool isTileInLOS(BattleAction *action, Tile *tile, bool drawing);
 	/// Turn XCom soldier's personal lighting on or off.
@@ -300,4 +314,20 @@ public:
 
 };
 
+/**
+ * Keeps the visibility cache of the tile engine enabled while in scope.
+ */
+class TileEngineVisibilityCacheScope
+{
+	TileEngine *_tileEngine;
+public:
+	/// Starts caching visibility checks.
+	TileEngineVisibilityCacheScope(TileEngine *tileEngine) : _tileEngine(tileEngine) { _tileEngine->startVisibilityCache(); }
+	/// Stops caching visibility checks.
+	~TileEngineVisibilityCacheScope() { _tileEngine->stopVisibilityCache(); }
+
+	TileEngineVisibilityCacheScope(const TileEngineVisibilityCacheScope&) = delete;
+	TileEngineVisibilityCacheScope& operator=(const TileEngineVisibilityCacheScope&) = delete;
+};
+
 }
@@ -221,6 +221,8 @@ void UnitWalkBState::think()
 			int change = _parent->checkForProximityGrenades(_unit);
 			// move our personal lighting with us
 			_terrain->calculateLighting(change ? LL_ITEMS : LL_UNITS, _unit->getPosition(), 2);
+			// reaction fire below checks again what the FOV update has just checked
+			TileEngineVisibilityCacheScope visibilityCache(_terrain);
 			_terrain->calculateFOV(_unit->getPosition(), 2, false); //update unit visibility for all units which can see last and current position.
 			//tile visibility for this unit is handled later.
 			unitSpotted = (!_action.ignoreSpottedEnemies && !_falling && !_action.desperate && _parent->getPanicHandled() && _numUnitsSpotted != _unit->getUnitsSpottedThisTurn().size());
@@ -19,6 +19,7 @@
  */
 #include <vector>
 #include <list>
+#include <deque>
 #include <unordered_map>
 #include <algorithm>
 #include "Exception.h"
@@ -568,7 +569,7 @@ public:
 	class NamesToIndex
 	{
 		std::unordered_map<std::string, size_t> _usedValues;
-		std::unordered_map<size_t, std::string> _usedNames{ { 0, "" } };
+		std::deque<std::string> _usedNames{ "" }; //deque keep references to names stable when new one is added
 		size_t _last = 1; //zero is reserved for "empty"
 
 	public:
@@ -591,10 +592,25 @@ public:
 				throw Exception("Number of unique names reached limit because of name '" + name + "'");
 			}
 			ref = _last++;
-			_usedNames[ref] = name;
+			_usedNames.push_back(name);
 			return ref;
 		}
 
+		/**
+		 * Return an index for a given name without adding it
+		 * @param name Name to find
+		 * @return Index assigned to a name or zero if name was never added.
+		 */
+		size_t getIndex(const std::string& name) const
+		{
+			auto f = _usedValues.find(name);
+			if (f != _usedValues.end())
+			{
+				return f->second;
+			}
+			return 0;
+		}
+
 		/**
 		 * Get name based on index
 		 * @param i Index
@@ -602,12 +618,20 @@ public:
 		 */
 		const std::string& getName(size_t i) const
 		{
-			auto f = _usedNames.find(i);
-			if (f != _usedNames.end())
+			if (i < _last)
 			{
-				return f->second;
+				return _usedNames[i];
 			}
-			return _usedNames.find(0)->second;
+			return _usedNames[0];
+		}
+
+		/**
+		 * Get upper limit of assigned indexes.
+		 * @return Index greater than any assigned one.
+		 */
+		size_t size() const
+		{
+			return _last;
 		}
 	};
 };
@@ -35,6 +35,7 @@
 #include "Exception.h"
 #include "Options.h"
 #include "Unicode.h"
+#include "../../libs/miniz/miniz.h"
 #ifdef _WIN32
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -899,6 +900,34 @@ time_t getDateModified(const std::string &path)
 #endif
 }
 
+/**
+ * Gets the size of a file.
+ * @param path Full path to file.
+ * @return The size in bytes, 0 if it can't be read.
+ */
+Uint64 getFileSize(const std::string &path)
+{
+#ifdef _WIN32
+	auto pathW = pathToWindows(path);
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (GetFileAttributesExW(pathW.c_str(), GetFileExInfoStandard, &data))
+	{
+		return ((Uint64)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+	}
+	return 0;
+#else
+	struct stat info;
+	if (stat(path.c_str(), &info) == 0)
+	{
+		return info.st_size;
+	}
+	else
+	{
+		return 0;
+	}
+#endif
+}
+
 /**
  * Converts a date/time into a human-readable string
  * using the ISO 8601 standard.
@@ -1093,9 +1122,127 @@ std::unique_ptr<std::istream> getYamlSaveHeader(const std::string& filename) {
 		offs = size;
 	}
 	SDL_RWclose(rwops);
+	// do not hand over anything past the header, the rest could be a compressed body
+	const char *end = strstr(data, "\n---");
+	if (end != NULL)
+	{
+		size = (end - data) + 4;
+		data[size] = 0;
+	}
 	return std::unique_ptr<std::istream>(new StreamData(RawData{data, size, SDL_free}));
 }
 
+namespace
+{
+
+/// Marker that follows the header of a compressed savegame.
+const char SaveCompressedMarker[] = "#OXCZ ";
+const size_t SaveCompressedMarkerSize = sizeof(SaveCompressedMarker) - 1;
+
+/**
+ * Finds where the header of a savegame ends, i.e. the first character after the line with the "---" separator.
+ * @param data - savegame data
+ * @param size - size of data
+ * @return offset of the body, or size if there is no separator.
+ */
+size_t findSaveBody(const char *data, size_t size)
+{
+	const char separator[] = "\n---";
+	const char *end = data + size;
+	const char *found = std::search(data, end, separator, separator + sizeof(separator) - 1);
+	if (found == end)
+	{
+		return size;
+	}
+	found = std::find(found + sizeof(separator) - 1, end, '\n');
+	return found == end ? size : (found - data) + 1;
+}
+
+} // namespace
+
+/**
+ * Writes a savegame, optionally compressing everything after the brief header.
+ * The header stays plain text so it can still be read with getYamlSaveHeader.
+ * @param filename - where to write
+ * @param data - YAML contents of the savegame
+ * @param compress - if the body should be compressed
+ * @return if we did write it.
+ */
+bool writeSaveFile(const std::string& filename, const std::string& data, bool compress)
+{
+	if (!compress)
+	{
+		return writeFile(filename, data);
+	}
+	size_t bodyOffset = findSaveBody(data.data(), data.size());
+	size_t bodySize = data.size() - bodyOffset;
+	std::string marker = SaveCompressedMarker + std::to_string(bodySize) + "\n";
+
+	mz_ulong compressedSize = mz_compressBound((mz_ulong)bodySize);
+	std::vector<unsigned char> buffer(bodyOffset + marker.size() + compressedSize);
+	std::copy(data.begin(), data.begin() + bodyOffset, buffer.begin());
+	std::copy(marker.begin(), marker.end(), buffer.begin() + bodyOffset);
+	unsigned char *dest = buffer.data() + bodyOffset + marker.size();
+	int status = mz_compress2(dest, &compressedSize, (const unsigned char *)data.data() + bodyOffset, (mz_ulong)bodySize, MZ_DEFAULT_LEVEL);
+	if (status != MZ_OK)
+	{
+		Log(LOG_ERROR) << "Failed to compress " << filename << ": " << mz_error(status);
+		return false;
+	}
+	buffer.resize(bodyOffset + marker.size() + compressedSize);
+	return writeFile(filename, buffer);
+}
+
+/**
+ * Gets an istream to a savegame, uncompressing its body if needed.
+ * @param filename - what to read
+ * @return the istream
+ */
+std::unique_ptr<std::istream> readSaveFile(const std::string& filename)
+{
+	auto file = readFile(filename);
+	RawData raw = static_cast<StreamData*>(file.get())->extractRawData();
+	const char *data = (const char *)raw.data();
+	size_t size = raw.size();
+
+	size_t bodyOffset = findSaveBody(data, size);
+	if (size - bodyOffset < SaveCompressedMarkerSize || memcmp(data + bodyOffset, SaveCompressedMarker, SaveCompressedMarkerSize) != 0)
+	{
+		return std::unique_ptr<std::istream>(new StreamData(std::move(raw)));
+	}
+
+	const char *markerEnd = std::find(data + bodyOffset, data + size, '\n');
+	if (markerEnd == data + size)
+	{
+		std::string err = "Failed to read " + filename + ": truncated compressed save";
+		Log(LOG_ERROR) << err;
+		throw Exception(err);
+	}
+	size_t bodySize = std::strtoull(data + bodyOffset + SaveCompressedMarkerSize, nullptr, 10);
+	const unsigned char *source = (const unsigned char *)markerEnd + 1;
+	mz_ulong sourceSize = (mz_ulong)(data + size - markerEnd - 1);
+
+	char *result = (char *)SDL_malloc(bodyOffset + bodySize + 1);
+	if (result == NULL)
+	{
+		std::string err(SDL_GetError());
+		Log(LOG_ERROR) << err;
+		throw Exception(err);
+	}
+	memcpy(result, data, bodyOffset);
+	mz_ulong resultSize = (mz_ulong)bodySize;
+	int status = mz_uncompress((unsigned char *)result + bodyOffset, &resultSize, source, sourceSize);
+	if (status != MZ_OK || resultSize != bodySize)
+	{
+		SDL_free(result);
+		std::string err = "Failed to read " + filename + ": " + (status != MZ_OK ? mz_error(status) : "size mismatch");
+		Log(LOG_ERROR) << err;
+		throw Exception(err);
+	}
+	result[bodyOffset + bodySize] = 0;
+	return std::unique_ptr<std::istream>(new StreamData(RawData{result, bodyOffset + bodySize, SDL_free}));
+}
+
 /**
  * Notifies the user that maybe he should have a look.
  */
@@ -226,6 +226,8 @@ namespace CrossPlatform
 	bool isQuitShortcut(const SDL_Event &ev);
 	/// Gets the modified date of a file.
 	time_t getDateModified(const std::string &path);
+	/// Gets the size of a file.
+	Uint64 getFileSize(const std::string &path);
 	/// Converts a timestamp to a string.
 	std::pair<std::string, std::string> timeToString(time_t time);
 	/// Move/rename a file between paths.
@@ -239,6 +241,10 @@ namespace CrossPlatform
 	std::unique_ptr<std::istream> readFile(const std::string& filename);
 	/// Reads file until "\n---" sequence is met or to the end. To be used only for savegames.
 	std::unique_ptr<std::istream> getYamlSaveHeader (const std::string& filename);
+	/// Writes out a savegame, optionally compressing everything after the header.
+	bool writeSaveFile(const std::string& filename, const std::string& data, bool compress);
+	/// Reads in a savegame, compressed or not.
+	std::unique_ptr<std::istream> readSaveFile(const std::string& filename);
 	/// Flashes the game window.
 	void flashWindow();
 	/// Gets the DOS-style executable path.
@@ -19,11 +19,13 @@
 #include "Game.h"
 #include "../resource.h"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <sstream>
 #include <SDL_mixer.h>
 #include "State.h"
 #include "Screen.h"
+#include "SurfaceSet.h"
 #include "Sound.h"
 #include "Music.h"
 #include "Language.h"
@@ -42,6 +44,8 @@
 #include "../Ufopaedia/UfopaediaStartState.h"
 #include "../Menu/NotesState.h"
 #include "../Menu/TestState.h"
+#include "../Menu/SaveGameState.h"
+#include "Profiler.h"
 #include <algorithm>
 #include "../fallthrough.h"
 
@@ -50,13 +54,25 @@ namespace OpenXcom
 
 const double Game::VOLUME_GRADIENT = 10.0;
 
+/**
+ * Saved game snapshot waiting to be written to disk.
+ */
+struct Game::SaveJob
+{
+	std::string fullPath, bakPath, backup;
+	YAML::Node brief, doc;
+	bool compress;
+	std::string error;
+	std::atomic<bool> done{ false };
+};
+
 /**
  * Starts up all the SDL subsystems,
  * creates the display screen and sets up the cursor.
  * @param title Title of the game window.
  */
 Game::Game(const std::string &title) : _screen(0), _cursor(0), _lang(0), _save(0), _mod(0), _quit(false), _init(false), _update(false),  _mouseActive(true), _timeUntilNextFrame(0),
-	_ctrl(false), _alt(false), _shift(false), _rmb(false), _mmb(false)
+	_ctrl(false), _alt(false), _shift(false), _rmb(false), _mmb(false), _saveThread(0), _saveJob(0)
 {
 	Options::reload = false;
 	Options::mute = false;
@@ -111,6 +127,12 @@ Game::Game(const std::string &title) : _screen(0), _cursor(0), _lang(0), _save(0
  */
 Game::~Game()
 {
+	std::string saveError = waitForSave();
+	if (!saveError.empty())
+	{
+		Log(LOG_ERROR) << saveError;
+	}
+
 	Sound::stop();
 	Music::stop();
 
@@ -179,6 +201,11 @@ void Game::run()
 		}
 
 		// Process events
+		const bool profileEvents = Profiler::isEnabled(); // profiling can be toggled by one of these events
+		if (profileEvents)
+		{
+			Profiler::begin("Game::events");
+		}
 		while (SDL_PollEvent(&_event))
 		{
 			if (CrossPlatform::isQuitShortcut(_event))
@@ -326,12 +353,20 @@ void Game::run()
 				break;
 			}
 		}
+		if (profileEvents)
+		{
+			Profiler::end();
+		}
 
 		// Process rendering
 		if (runningState != PAUSED)
 		{
 			// Process logic
-			_states.back()->think();
+			{
+				OXCE_PROFILE_SCOPE("State::think");
+				_states.back()->think();
+			}
+			checkBackgroundSave();
 			_fpsCounter->think();
 			if (Options::FPS > 0 && !(Options::useOpenGL && Options::vSyncForOpenGL))
 			{
@@ -358,13 +393,27 @@ void Game::run()
 				}
 				while (i != _states.begin() && !(*i)->isScreen());
 
-				for (; i != _states.end(); ++i)
 				{
-					(*i)->blit();
+					OXCE_PROFILE_SCOPE("State::blit");
+					for (; i != _states.end(); ++i)
+					{
+						(*i)->blit();
+					}
 				}
 				_fpsCounter->blit(_screen->getSurface());
 				_cursor->blit(_screen->getSurface());
-				_screen->flip();
+				{
+					OXCE_PROFILE_SCOPE("Screen::flip");
+					_screen->flip();
+				}
+				Profiler::endFrame();
+
+				// all frames drawn by now, safe to free the ones not used lately
+				if (Options::lazyLoadResources && Options::oxceSpriteCacheLimit > 0 && _mod)
+				{
+					_mod->trimSpriteCache((size_t)Options::oxceSpriteCacheLimit * 1024 * 1024);
+				}
+				SurfaceSet::nextLazyFramesTick();
 			}
 		}
 
@@ -495,6 +544,106 @@ void Game::setSavedGame(SavedGame *save)
 	_save = save;
 }
 
+/**
+ * Takes a snapshot of the current saved game and writes it
+ * to disk in a separate thread, so the game can go on meanwhile.
+ * Only building the snapshot nodes is left on the main thread,
+ * emitting the YAML, compressing and writing all happen in the thread.
+ * The save is written to a backup file first and then moved
+ * over the original, same as a regular save.
+ * @param filename Save filename.
+ */
+void Game::saveInBackground(const std::string &filename)
+{
+	std::string saveError = waitForSave();
+	if (!saveError.empty())
+	{
+		Log(LOG_ERROR) << saveError;
+	}
+
+	_saveJob = new SaveJob();
+	_saveJob->backup = filename + ".bak";
+	_saveJob->fullPath = Options::getMasterUserFolder() + filename;
+	_saveJob->bakPath = Options::getMasterUserFolder() + _saveJob->backup;
+	_save->snapshot(_saveJob->brief, _saveJob->doc, _mod);
+	_saveJob->compress = Options::oxceCompressedSaves;
+
+	_saveThread = SDL_CreateThread(writeSave, (void*)_saveJob);
+	if (_saveThread == 0)
+	{
+		// If we can't create the thread, just write it as usual
+		writeSave((void*)_saveJob);
+	}
+}
+
+/**
+ * Reports a failed background save as soon as the thread is done,
+ * without waiting for it otherwise.
+ */
+void Game::checkBackgroundSave()
+{
+	if (_saveJob == 0 || !_saveJob->done)
+	{
+		return;
+	}
+	std::string saveError = waitForSave();
+	if (!saveError.empty() && !_states.empty())
+	{
+		SaveGameState::showError(this, saveError, _states.back()->getPalette(), _save != 0 && _save->getSavedBattle() != 0);
+	}
+}
+
+/**
+ * Waits until the background save (if any) is written to disk.
+ * @return Error message, empty if the save was successful.
+ */
+std::string Game::waitForSave()
+{
+	if (_saveThread != 0)
+	{
+		SDL_WaitThread(_saveThread, 0);
+		_saveThread = 0;
+	}
+	std::string error;
+	if (_saveJob != 0)
+	{
+		error = _saveJob->error;
+		delete _saveJob;
+		_saveJob = 0;
+	}
+	return error;
+}
+
+/**
+ * Writes a saved game snapshot to disk.
+ * @param job_ptr Pointer to the save job.
+ * @return Thread status, 0 = ok
+ */
+int Game::writeSave(void *job_ptr)
+{
+	SaveJob *job = (SaveJob*)job_ptr;
+	try
+	{
+		std::string data = SavedGame::emitSnapshot(job->brief, job->doc);
+		job->brief.reset();
+		job->doc.reset();
+		if (!CrossPlatform::writeSaveFile(job->bakPath, data, job->compress))
+		{
+			job->error = "Failed to save " + job->bakPath;
+		}
+		else if (!CrossPlatform::moveFile(job->bakPath, job->fullPath))
+		{
+			job->error = "Save backed up in " + job->backup;
+		}
+	}
+	catch (YAML::Exception &e)
+	{
+		job->error = e.what();
+	}
+	job->done = true;
+	return job->error.empty() ? 0 : -1;
+}
+
 /**
  * Loads the mods specified in the game options.
  */
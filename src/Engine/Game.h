@@ -43,6 +43,8 @@ class Action;
 class Game
 {
 private:
+	struct SaveJob;
+
 	SDL_Event _event;
 	Screen *_screen;
 	Cursor *_cursor;
@@ -56,8 +58,13 @@ private:
 	unsigned int _timeOfLastFrame;
 	int _timeUntilNextFrame;
 	bool _ctrl, _alt, _shift, _rmb, _mmb;
+	SDL_Thread *_saveThread;
+	SaveJob *_saveJob;
 	static const double VOLUME_GRADIENT;
 
+	/// Writes a saved game snapshot to disk.
+	static int writeSave(void *job_ptr);
+
 public:
 	/// Creates a new game and initializes SDL.
 	Game(const std::string &title);
@@ -89,6 +96,12 @@ public:
 	SavedGame *getSavedGame() const { return _save; }
 	/// Sets a new saved game for the game.
 	void setSavedGame(SavedGame *save);
+	/// Writes the current saved game to disk in the background.
+	void saveInBackground(const std::string &filename);
+	/// Reports a failed background save once it's finished.
+	void checkBackgroundSave();
+	/// Waits until a background save is finished.
+	std::string waitForSave();
 	/// Gets the currently loaded mod.
 	Mod *getMod() const { return _mod; }
 	/// Loads the mods specified in the game options.
@@ -0,0 +1,79 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace OpenXcom
+{
+
+/**
+ * Allocator for objects of one type, handing out memory from chunks of many objects.
+ * Freed memory is kept on a free list and reused for the next object.
+ * When the last object is freed (e.g. when a battle ends) all chunks are released.
+ */
+template<typename T, std::size_t ChunkSize = 256>
+class ObjectPool
+{
+	union Block
+	{
+		Block *next;
+		alignas(T) unsigned char data[sizeof(T)];
+	};
+
+	std::vector<std::unique_ptr<Block[]>> _chunks;
+	Block *_free = nullptr;
+	std::size_t _used = 0;
+
+public:
+	/// Gets memory for one object.
+	void *allocate()
+	{
+		if (!_free)
+		{
+			_chunks.emplace_back(new Block[ChunkSize]);
+			Block *chunk = _chunks.back().get();
+			for (std::size_t i = ChunkSize; i > 0; --i)
+			{
+				chunk[i - 1].next = _free;
+				_free = &chunk[i - 1];
+			}
+		}
+		Block *block = _free;
+		_free = block->next;
+		++_used;
+		return block;
+	}
+
+	/// Returns memory of one object to the pool.
+	void deallocate(void *p)
+	{
+		Block *block = static_cast<Block*>(p);
+		block->next = _free;
+		_free = block;
+		if (--_used == 0)
+		{
+			_chunks.clear();
+			_free = nullptr;
+		}
+	}
+};
+
+}
@@ -253,6 +253,8 @@ void create()
 	_info.push_back(OptionInfo("oxceEmbeddedOnly", &oxceEmbeddedOnly, true));
 	_info.push_back(OptionInfo("oxceListVFSContents", &oxceListVFSContents, false));
 	_info.push_back(OptionInfo("oxceRawScreenShots", &oxceRawScreenShots, false));
+	_info.push_back(OptionInfo("oxceCompressedSaves", &oxceCompressedSaves, false));
+	_info.push_back(OptionInfo("oxceSpriteCacheLimit", &oxceSpriteCacheLimit, 0)); // MB of lazily loaded sprites to keep, 0 = no limit
 	_info.push_back(OptionInfo("oxceFirstPersonViewFisheyeProjection", &oxceFirstPersonViewFisheyeProjection, false));
 	_info.push_back(OptionInfo("oxceThumbButtons", &oxceThumbButtons, true));
 
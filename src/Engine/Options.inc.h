@@ -105,6 +105,8 @@ OPT int oxceModValidationLevel;
 OPT bool oxceEmbeddedOnly;
 OPT bool oxceListVFSContents;
 OPT bool oxceRawScreenShots;
+OPT bool oxceCompressedSaves;
+OPT int oxceSpriteCacheLimit;
 OPT bool oxceFirstPersonViewFisheyeProjection;
 OPT bool oxceThumbButtons;
 
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include "CrossPlatform.h"
+
+namespace OpenXcom
+{
+
+namespace Profiler
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// Section that was started and not yet stopped.
+struct OpenSection
+{
+	const char *name;
+	Clock::time_point start;
+};
+
+/// Section that was stopped, kept for the trace file.
+struct TraceEvent
+{
+	const char *name;
+	long long start;
+	long long duration;
+};
+
+/// Total time of all sections of one name since the last report.
+struct SectionTotal
+{
+	const char *name;
+	int depth;
+	long long time;
+};
+
+/// Stop keeping trace events past this, about 24 MB.
+const size_t TraceMax = 1 << 20;
+
+bool _enabled = false;
+Clock::time_point _origin;
+std::vector<OpenSection> _open;
+std::vector<TraceEvent> _trace;
+std::vector<SectionTotal> _totals;
+int _frames = 0;
+
+long long microseconds(Clock::duration d)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+
+}
+
+/**
+ * Checks if profiling is enabled.
+ * @return True if sections are timed.
+ */
+bool isEnabled()
+{
+	return _enabled;
+}
+
+/**
+ * Enables or disables profiling. Enabling it drops everything recorded before.
+ * @param enabled Should sections be timed?
+ */
+void setEnabled(bool enabled)
+{
+	if (enabled && !_enabled)
+	{
+		_origin = Clock::now();
+		_trace.clear();
+		_totals.clear();
+		_frames = 0;
+	}
+	_open.clear();
+	_enabled = enabled;
+}
+
+/**
+ * Starts timing a section, nested in the last started one.
+ * @param name Name of the section, must be a string literal.
+ */
+void begin(const char *name)
+{
+	_open.push_back({ name, Clock::now() });
+}
+
+/**
+ * Stops timing the last started section.
+ */
+void end()
+{
+	if (_open.empty())
+	{
+		// profiling was toggled while the section ran
+		return;
+	}
+	const OpenSection section = _open.back();
+	_open.pop_back();
+	const long long duration = microseconds(Clock::now() - section.start);
+	const int depth = (int)_open.size();
+
+	if (_trace.size() < TraceMax)
+	{
+		_trace.push_back({ section.name, microseconds(section.start - _origin), duration });
+	}
+
+	for (auto& total : _totals)
+	{
+		if (total.depth == depth && std::strcmp(total.name, section.name) == 0)
+		{
+			total.time += duration;
+			return;
+		}
+	}
+	_totals.push_back({ section.name, depth, duration });
+}
+
+/**
+ * Marks the end of a frame, used to average the section times.
+ */
+void endFrame()
+{
+	if (_enabled)
+	{
+		++_frames;
+	}
+}
+
+/**
+ * Gets the average time per frame of each section, indented by nesting,
+ * and starts collecting the next averages.
+ * @return One line per section.
+ */
+std::string getReport()
+{
+	std::ostringstream ss;
+	const int frames = std::max(_frames, 1);
+	ss << std::fixed << std::setprecision(2);
+	for (const auto& total : _totals)
+	{
+		ss << std::string(total.depth * 2, ' ') << total.name << " " << total.time / 1000.0 / frames << "ms\n";
+	}
+	_totals.clear();
+	_frames = 0;
+	return ss.str();
+}
+
+/**
+ * Writes all timed sections since profiling was enabled
+ * in the Chrome trace event format (chrome://tracing, Perfetto).
+ * @param filename Full path of the file.
+ * @return True if the file was written.
+ */
+bool saveTrace(const std::string &filename)
+{
+	std::ostringstream ss;
+	ss << "{\"traceEvents\":[";
+	bool first = true;
+	for (const auto& event : _trace)
+	{
+		if (!first)
+		{
+			ss << ",";
+		}
+		first = false;
+		ss << "\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+	}
+	ss << "\n]}\n";
+	return CrossPlatform::writeFile(filename, ss.str());
+}
+
+}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+
+namespace OpenXcom
+{
+
+/**
+ * Measures the time spent in named, nested sections of the main loop.
+ * Sections are only timed while profiling is enabled, and only on the main thread.
+ */
+namespace Profiler
+{
+	/// Is profiling enabled?
+	bool isEnabled();
+	/// Enables or disables profiling.
+	void setEnabled(bool enabled);
+	/// Starts timing a section.
+	void begin(const char *name);
+	/// Stops timing the last started section.
+	void end();
+	/// Marks the end of a frame.
+	void endFrame();
+	/// Gets the average time per frame of each section since the last call.
+	std::string getReport();
+	/// Writes all timed sections as a Chrome trace file.
+	bool saveTrace(const std::string &filename);
+}
+
+/**
+ * Times a section of code while in scope.
+ */
+class ProfilerScope
+{
+	bool _active;
+public:
+	/// Starts timing the section.
+	explicit ProfilerScope(const char *name) : _active(Profiler::isEnabled()) { if (_active) Profiler::begin(name); }
+	/// Stops timing the section.
+	~ProfilerScope() { if (_active) Profiler::end(); }
+
+	ProfilerScope(const ProfilerScope&) = delete;
+	ProfilerScope& operator=(const ProfilerScope&) = delete;
+};
+
+}
+
+#define OXCE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OXCE_PROFILE_CONCAT(a, b) OXCE_PROFILE_CONCAT_IMPL(a, b)
+
+#ifndef OXCE_NO_PROFILER
+/// Times the rest of the enclosing scope as a section with the given name (a string literal).
+#define OXCE_PROFILE_SCOPE(name) ::OpenXcom::ProfilerScope OXCE_PROFILE_CONCAT(profilerScope, __LINE__)(name)
+#else
+#define OXCE_PROFILE_SCOPE(name)
+#endif
@@ -260,6 +260,8 @@ void State::init()
 	_game->getCursor()->setPalette(_palette);
 	_game->getCursor()->setColor(_cursorColor);
 	_game->getCursor()->draw();
+	if (_game->getLanguage() && _game->getMod())
+		_game->getFpsCounter()->initText(_game->getMod()->getFont("FONT_BIG"), _game->getMod()->getFont("FONT_SMALL"), _game->getLanguage());
 	_game->getFpsCounter()->setPalette(_palette);
 	_game->getFpsCounter()->setColor(_cursorColor);
 	_game->getFpsCounter()->draw();
@@ -20,16 +20,26 @@
 #include <climits>
 #include "Surface.h"
 #include "FileMap.h"
+#include "Exception.h"
+#include "Logger.h"
 
 namespace OpenXcom
 {
 
+namespace
+{
+
+/// Current frame tick, used to find deferred frames that were not drawn lately.
+Uint32 lazyFramesTick = 1;
+
+}
+
 /**
  * Sets up a new empty surface set for frames of the specified size.
  * @param width Frame width in pixels.
  * @param height Frame height in pixels.
  */
-SurfaceSet::SurfaceSet(int width, int height) : _width(width), _height(height), _sharedFrames(INT_MAX)
+SurfaceSet::SurfaceSet(int width, int height) : _width(width), _height(height), _sharedFrames(INT_MAX), _lazyBytes(0)
 {
 
 }
@@ -54,6 +64,8 @@ SurfaceSet::~SurfaceSet()
 void SurfaceSet::loadPck(const std::string &pck, const std::string &tab)
 {
 	_frames.clear();
+	_lazyFrames.clear();
+	_lazyBytes = 0;
 
 	int nframes = 0;
 
@@ -149,6 +161,8 @@ void SurfaceSet::loadDat(const std::string &filename)
 	nframes = (int)size / (_width * _height);
 
 	_frames.resize(nframes);
+	_lazyFrames.clear();
+	_lazyBytes = 0;
 	for (int i = 0; i < nframes; ++i)
 	{
 		_frames[i] = Surface(_width, _height);
@@ -190,6 +204,10 @@ Surface *SurfaceSet::getFrame(int i)
 {
 	if ((size_t)i < _frames.size())
 	{
+		if ((size_t)i < _lazyFrames.size())
+		{
+			useLazyFrame(i);
+		}
 		if (_frames[i])
 		{
 			return &_frames[i];
@@ -207,6 +225,10 @@ const Surface *SurfaceSet::getFrame(int i) const
 {
 	if ((size_t)i < _frames.size())
 	{
+		if ((size_t)i < _lazyFrames.size())
+		{
+			useLazyFrame(i);
+		}
 		if (_frames[i])
 		{
 			return &_frames[i];
@@ -231,10 +253,170 @@ Surface *SurfaceSet::addFrame(int i)
 	{
 		_frames.resize(i + 1);
 	}
+	forgetLazyFrame(i);
 	_frames[i] = Surface(_width, _height);
 	return &_frames[i];
 }
 
+/**
+ * Registers an image file to be loaded into a frame the first time
+ * that frame is requested, so sprites that are never shown
+ * in a session never take up memory.
+ * The frame slot is reserved right away, so pointers to other frames
+ * stay valid when the image is finally loaded.
+ * @param i Frame number in the set.
+ * @param filename Filename of the image.
+ */
+void SurfaceSet::setLazyFrame(int i, const std::string &filename)
+{
+	assert(i >= 0 && "Negative indexes are not supported in SurfaceSet");
+	if ((size_t)i >= _frames.size())
+	{
+		_frames.resize(i + 1);
+	}
+	forgetLazyFrame(i);
+	if ((size_t)i >= _lazyFrames.size())
+	{
+		_lazyFrames.resize(_frames.size());
+	}
+	_lazyFrames[i].file = filename;
+}
+
+/**
+ * Drops the deferred image of a frame, e.g. when a later mod replaces it,
+ * so the frame is never reloaded from the old file.
+ * An already decoded image stays in the frame.
+ * @param i Frame number in the set.
+ */
+void SurfaceSet::forgetLazyFrame(int i)
+{
+	if ((size_t)i < _lazyFrames.size())
+	{
+		_lazyBytes -= _lazyFrames[i].bytes;
+		_lazyFrames[i] = LazyFrame();
+	}
+}
+
+/**
+ * Marks a deferred frame as used in the current frame tick
+ * and decodes it if it's not loaded yet.
+ * @param i Frame number in the set.
+ */
+void SurfaceSet::useLazyFrame(int i) const
+{
+	LazyFrame &lazy = _lazyFrames[i];
+	if (lazy.file.empty())
+	{
+		return;
+	}
+	lazy.lastUse = lazyFramesTick;
+	if (!lazy.loaded)
+	{
+		loadLazyFrame(i);
+	}
+}
+
+/**
+ * Loads the image of a deferred frame, replacing any existing
+ * frame in place, and applies the palette the set was given since.
+ * A broken image is logged and leaves the frame blank,
+ * as a thrown error in the middle of a game would lose it.
+ * @param i Frame number in the set.
+ */
+void SurfaceSet::loadLazyFrame(int i) const
+{
+	LazyFrame &lazy = _lazyFrames[i];
+	lazy.loaded = true;
+
+	Surface &frame = _frames[i];
+	if (frame)
+	{
+		frame.clear();
+	}
+	else
+	{
+		frame = Surface(_width, _height);
+	}
+	try
+	{
+		frame.loadImage(lazy.file);
+	}
+	catch (Exception &e)
+	{
+		Log(LOG_ERROR) << "Failed to load frame " << i << " from " << lazy.file << ": " << e.what();
+		frame = Surface(_width, _height);
+	}
+	if (!frame)
+	{
+		// missing file, already logged by FileMap
+		return;
+	}
+	for (int first = 0; first < 256; )
+	{
+		if (!_lazyPaletteUsed[first])
+		{
+			++first;
+			continue;
+		}
+		int last = first;
+		while (last < 256 && _lazyPaletteUsed[last])
+		{
+			++last;
+		}
+		frame.setPalette(_lazyPalette.data() + first, first, last - first);
+		first = last;
+	}
+	lazy.bytes = (size_t)frame.getWidth() * frame.getHeight();
+	_lazyBytes += lazy.bytes;
+}
+
+/**
+ * Lists the decoded deferred frames that were not used
+ * in the current frame tick, so they can be freed safely.
+ * @param frames Gets the last use tick and index of each frame appended.
+ */
+void SurfaceSet::listUnusedLazyFrames(std::vector<std::pair<Uint32, int>> &frames) const
+{
+	for (size_t i = 0; i < _lazyFrames.size(); ++i)
+	{
+		const LazyFrame &lazy = _lazyFrames[i];
+		if (lazy.loaded && lazy.bytes && lazy.lastUse != lazyFramesTick)
+		{
+			frames.push_back(std::make_pair(lazy.lastUse, (int)i));
+		}
+	}
+}
+
+/**
+ * Frees the image of a decoded deferred frame.
+ * The frame is decoded again from its file the next time it's requested.
+ * @param i Frame number in the set.
+ * @return Memory freed.
+ */
+size_t SurfaceSet::freeLazyFrame(int i)
+{
+	if ((size_t)i >= _lazyFrames.size() || !_lazyFrames[i].loaded)
+	{
+		return 0;
+	}
+	LazyFrame &lazy = _lazyFrames[i];
+	size_t freed = lazy.bytes;
+	_lazyBytes -= freed;
+	lazy.bytes = 0;
+	lazy.loaded = false;
+	_frames[i] = Surface();
+	return freed;
+}
+
+/**
+ * Starts a new frame tick. Deferred frames used before this call
+ * count as not used in the new tick.
+ */
+void SurfaceSet::nextLazyFramesTick()
+{
+	++lazyFramesTick;
+}
+
 /**
  * Returns the full width of a frame in the set.
  * @return Width in pixels.
@@ -294,6 +476,15 @@ size_t SurfaceSet::getTotalFrames() const
  */
 void SurfaceSet::setPalette(const SDL_Color *colors, int firstcolor, int ncolors)
 {
+	if (!_lazyFrames.empty())
+	{
+		_lazyPalette.resize(256);
+		for (int c = 0; c < ncolors && firstcolor + c < 256; ++c)
+		{
+			_lazyPalette[firstcolor + c] = colors[c];
+			_lazyPaletteUsed[firstcolor + c] = true;
+		}
+	}
 	for (size_t i = 0; i < _frames.size(); ++i)
 	{
 		if (_frames[i])
@@ -20,6 +20,8 @@
 
 #include <vector>
 #include <string>
+#include <bitset>
+#include <utility>
 #include <SDL.h>
 
 namespace OpenXcom
@@ -36,9 +38,29 @@ class Surface;
 class SurfaceSet
 {
 private:
-	std::vector<Surface> _frames;
+	mutable std::vector<Surface> _frames;
 	int _width, _height;
 	int _sharedFrames;
+	/// Image file of a frame that is decoded on first access.
+	struct LazyFrame
+	{
+		std::string file;
+		Uint32 lastUse = 0;
+		size_t bytes = 0;
+		bool loaded = false;
+	};
+	/// Deferred frames, indexed like the frames themselves.
+	mutable std::vector<LazyFrame> _lazyFrames;
+	/// Memory taken by the currently decoded deferred frames.
+	mutable size_t _lazyBytes;
+	/// Palette colors applied to the set, reused for lazy frames.
+	std::vector<SDL_Color> _lazyPalette;
+	std::bitset<256> _lazyPaletteUsed;
+
+	/// Decodes a frame deferred by setLazyFrame.
+	void loadLazyFrame(int i) const;
+	/// Marks a deferred frame as used and decodes it if needed.
+	void useLazyFrame(int i) const;
 
 public:
 	/// Crates a surface set with frames of the specified size.
@@ -64,6 +86,18 @@ public:
 	const Surface *getFrame(int i) const;
 	/// Creates a new surface and returns a pointer to it.
 	Surface *addFrame(int i);
+	/// Defers loading a frame from an image file until it is first used.
+	void setLazyFrame(int i, const std::string &filename);
+	/// Stops treating a frame as deferred.
+	void forgetLazyFrame(int i);
+	/// Gets the memory taken by the decoded deferred frames.
+	size_t getLazyFramesBytes() const { return _lazyBytes; }
+	/// Lists decoded deferred frames not used in the current frame tick.
+	void listUnusedLazyFrames(std::vector<std::pair<Uint32, int>> &frames) const;
+	/// Frees a decoded deferred frame, it will be decoded again on next use.
+	size_t freeLazyFrame(int i);
+	/// Starts a new frame tick for tracking deferred frames use.
+	static void nextLazyFramesTick();
 	/// Gets the width of all frames.
 	int getWidth() const;
 	/// Gets the height of all frames.
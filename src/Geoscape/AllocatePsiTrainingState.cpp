@@ -217,7 +217,7 @@ void AllocatePsiTrainingState::cbxSortByChange(Action *action)
 		}
 		else
 		{
-			std::stable_sort(_base->getSoldiers()->begin(), _base->getSoldiers()->end(), *compFunc);
+			compFunc->sort(*_base->getSoldiers());
 		}
 		if (_game->isShiftPressed())
 		{
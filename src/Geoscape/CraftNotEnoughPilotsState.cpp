@@ -65,7 +65,7 @@ CraftNotEnoughPilotsState::CraftNotEnoughPilotsState(Craft *craft) : _craft(craf
 	_btnAssignPilots->setText(tr("STR_ASSIGN_PILOTS"));
 	_btnAssignPilots->onMouseClick((ActionHandler)&CraftNotEnoughPilotsState::btnAssignPilotsClick);
 	_btnAssignPilots->onKeyboardPress((ActionHandler)&CraftNotEnoughPilotsState::btnAssignPilotsClick, Options::keyOk);
-	if (_craft->getMissionComplete() || _craft->getStatus() == "STR_OUT")
+	if (_craft->getMissionComplete() || _craft->getStatus() == CRAFT_OUT)
 	{
 		_btnAssignPilots->setVisible(false);
 	}
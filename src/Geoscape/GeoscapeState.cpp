@@ -125,6 +125,7 @@
 #include "../Menu/ListSaveState.h"
 #include "../Mod/RuleGlobe.h"
 #include "../Engine/Exception.h"
+#include "../Engine/Profiler.h"
 #include "../Mod/AlienDeployment.h"
 #include "../Mod/AlienRace.h"
 #include "../Mod/RuleInterface.h"
@@ -811,6 +812,7 @@ void GeoscapeState::timeDisplay()
  */
 void GeoscapeState::timeAdvance()
 {
+	OXCE_PROFILE_SCOPE("GeoscapeState::timeAdvance");
 	int timeSpan = 0;
 	if (_timeSpeed == _btn5Secs)
 	{
@@ -895,7 +897,7 @@ const std::vector<Craft*>* GeoscapeState::updateActiveCrafts()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_OUT" && !xcraft->isDestroyed())
+			if (xcraft->getStatus() == CRAFT_OUT && !xcraft->isDestroyed())
 			{
 				_activeCrafts.push_back(xcraft);
 			}
@@ -1387,7 +1389,7 @@ void GeoscapeState::time5Seconds()
 				}
 				else if (x != 0)
 				{
-					if (x->getStatus() != "STR_OUT" || x->isDestroyed())
+					if (x->getStatus() != CRAFT_OUT || x->isDestroyed())
 					{
 						xcraft->returnToBase();
 					}
@@ -1501,7 +1503,7 @@ void GeoscapeState::time10Minutes()
 		// Fuel consumption for XCOM craft.
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_OUT")
+			if (xcraft->getStatus() == CRAFT_OUT)
 			{
 				int escortSpeed = 0;
 				{
@@ -1689,7 +1691,7 @@ void GeoscapeState::baseHunting()
 				for (auto* craft : *activeCrafts)
 				{
 					// Craft is flying (i.e. not in base)
-					if (craft->getStatus() == "STR_OUT" && !craft->isDestroyed() && !craft->getRules()->isUndetectable() && !craft->isIgnoredByHK())
+					if (craft->getStatus() == CRAFT_OUT && !craft->isDestroyed() && !craft->getRules()->isUndetectable() && !craft->isIgnoredByHK())
 					{
 						// Craft is close enough and RNG is in our favour
 						if (craft->getDistance(ab) < Nautical(ab->getDeployment()->getBaseDetectionRange()) && RNG::percent(ab->getDeployment()->getBaseDetectionChance()))
@@ -1887,20 +1889,20 @@ void GeoscapeState::time30Minutes()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_REFUELLING")
+			if (xcraft->getStatus() == CRAFT_REFUELLING)
 			{
 				std::string item = xcraft->refuel();
 
 				if (item.empty())
 				{
 					// notification
-					if (xcraft->getStatus() == "STR_READY" && xcraft->getRules()->notifyWhenRefueled())
+					if (xcraft->getStatus() == CRAFT_READY && xcraft->getRules()->notifyWhenRefueled())
 					{
 						std::string msg = tr("STR_CRAFT_IS_READY").arg(xcraft->getName(_game->getLanguage())).arg(xbase->getName());
 						popup(new CraftErrorState(this, msg));
 					}
 					// auto-patrol
-					if (xcraft->getStatus() == "STR_READY" && xcraft->getRules()->canAutoPatrol())
+					if (xcraft->getStatus() == CRAFT_READY && xcraft->getRules()->canAutoPatrol())
 					{
 						if (xcraft->getIsAutoPatrolling())
 						{
@@ -1913,7 +1915,7 @@ void GeoscapeState::time30Minutes()
 								_game->getSavedGame()->getWaypoints()->push_back(w);
 							}
 							xcraft->setDestination(w);
-							xcraft->setStatus("STR_OUT");
+							xcraft->setStatus(CRAFT_OUT);
 						}
 					}
 				}
@@ -2094,11 +2096,11 @@ void GeoscapeState::time1Hour()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_REPAIRS")
+			if (xcraft->getStatus() == CRAFT_REPAIRS)
 			{
 				xcraft->repair();
 			}
-			else if (xcraft->getStatus() == "STR_REARMING")
+			else if (xcraft->getStatus() == CRAFT_REARMING)
 			{
 				auto* ammo = xcraft->rearm();
 				if (ammo)
@@ -2110,7 +2112,7 @@ void GeoscapeState::time1Hour()
 					popup(new CraftErrorState(this, msg));
 				}
 			}
-			if (xcraft->getShieldCapacity() > 0 && xcraft->getStatus() != "STR_OUT")
+			if (xcraft->getShieldCapacity() > 0 && xcraft->getStatus() != CRAFT_OUT)
 			{
 				// Recharge craft shields in parallel (no wait for repair/rearm/refuel)
 				xcraft->setShield(xcraft->getShield() + xcraft->getRules()->getShieldRechargeAtBase());
@@ -2138,18 +2140,20 @@ void GeoscapeState::time1Hour()
 	// Handle Production
 	for (auto* xbase : *_game->getSavedGame()->getBases())
 	{
-		std::map<Production*, productionProgress_e> toRemove;
+		// most hours nothing finishes, so only the finished projects are remembered
+		std::vector<std::pair<Production*, productionProgress_e> > toRemove;
 		for (auto* prod : xbase->getProductions())
 		{
-			toRemove[prod] = prod->step(xbase, _game->getSavedGame(), _game->getMod(), _game->getLanguage());
+			productionProgress_e progress = prod->step(xbase, _game->getSavedGame(), _game->getMod(), _game->getLanguage());
+			if (progress > PROGRESS_NOT_COMPLETE)
+			{
+				toRemove.push_back(std::make_pair(prod, progress));
+			}
 		}
 		for (const auto& pair : toRemove)
 		{
-			if (pair.second > PROGRESS_NOT_COMPLETE)
-			{
-				popup(new ProductionCompleteState(xbase,  tr(pair.first->getRules()->getName()), this, pair.second, pair.first));
-				xbase->removeProduction(pair.first);
-			}
+			popup(new ProductionCompleteState(xbase,  tr(pair.first->getRules()->getName()), this, pair.second, pair.first));
+			xbase->removeProduction(pair.first);
 		}
 
 		if (Options::storageLimitsEnforced)
@@ -2164,9 +2168,9 @@ void GeoscapeState::time1Hour()
 			{
 				std::map<int, int> prisonTypes;
 				RuleItem *rule = nullptr;
-				for (const auto& item : *xbase->getStorageItems()->getContents())
+				for (const auto& item : *xbase->getStorageItems())
 				{
-					rule = _game->getMod()->getItem(item.first, true);
+					rule = _game->getMod()->getItemByTypeIndex(item.index, true);
 					if (rule->isAlien())
 					{
 						prisonTypes[rule->getPrisonType()] += 1;
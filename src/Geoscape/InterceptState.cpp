@@ -175,10 +175,10 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 		for (auto* xcraft : *xbase->getCrafts())
 		{
 			std::ostringstream ssStatus;
-			std::string status = xcraft->getStatus();
+			CraftStatus status = xcraft->getStatus();
 
 			bool hasEnoughPilots = xcraft->arePilotsOnboard();
-			if (status == "STR_OUT")
+			if (status == CRAFT_OUT)
 			{
 				// QoL: let's give the player a bit more info
 				if (xcraft->getDestination() == 0 || xcraft->getIsAutoPatrolling())
@@ -222,37 +222,37 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 					}
 					else
 					{
-						ssStatus << tr(status); // "STR_OUT"
+						ssStatus << tr(xcraft->getStatusString()); // "STR_OUT"
 					}
 				}
 			}
 			else
 			{
-				if (!hasEnoughPilots && status == "STR_READY")
+				if (!hasEnoughPilots && status == CRAFT_READY)
 				{
 					ssStatus << tr("STR_PILOT_MISSING");
 				}
 				else
 				{
-					ssStatus << tr(status);
+					ssStatus << tr(xcraft->getStatusString());
 				}
 			}
-			if (status != "STR_READY" && status != "STR_OUT")
+			if (status != CRAFT_READY && status != CRAFT_OUT)
 			{
 				unsigned int maintenanceHours = 0;
 
-				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == "STR_REPAIRS")
+				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == CRAFT_REPAIRS)
 				{
 					maintenanceHours += xcraft->calcRepairTime();
 				}
-				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == "STR_REFUELLING")
+				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == CRAFT_REFUELLING)
 				{
 					maintenanceHours += xcraft->calcRefuelTime();
 				}
-				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == "STR_REARMING")
+				if (Options::oxceInterceptGuiMaintenanceTimeHidden == 2 || xcraft->getStatus() == CRAFT_REARMING)
 				{
 					// Note: if the craft is already refueling, don't count any potential rearm time (can be > 0 if ammo is missing)
-					if (xcraft->getStatus() != "STR_REFUELLING")
+					if (xcraft->getStatus() != CRAFT_REFUELLING)
 					{
 						maintenanceHours += xcraft->calcRearmTime();
 					}
@@ -308,7 +308,7 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 			}
 			_crafts.push_back(xcraft);
 			_lstCrafts->addRow(4, xcraft->getName(_game->getLanguage()).c_str(), ssStatus.str().c_str(), xbase->getName().c_str(), ss.str().c_str());
-			if (hasEnoughPilots && status == "STR_READY")
+			if (hasEnoughPilots && status == CRAFT_READY)
 			{
 				_lstCrafts->setCellColor(row, 1, _lstCrafts->getSecondaryColor());
 			}
@@ -353,8 +353,8 @@ void InterceptState::lstCraftsLeftClick(Action *)
 	// condition used in shift and non-shift paths
 	auto allowStart = [&](Craft* c)
 	{
-		return c->getStatus() == "STR_READY" || (
-			 (c->getStatus() == "STR_OUT" || Options::craftLaunchAlways) &&
+		return c->getStatus() == CRAFT_READY || (
+			 (c->getStatus() == CRAFT_OUT || Options::craftLaunchAlways) &&
 			 !c->getLowFuel() &&
 			 !c->getMissionComplete() );
 	};
@@ -415,7 +415,7 @@ void InterceptState::lstCraftsLeftClick(Action *)
 void InterceptState::lstCraftsRightClick(Action *)
 {
 	Craft* c = _crafts[_lstCrafts->getSelectedRow()];
-	if (c->getStatus() == "STR_OUT")
+	if (c->getStatus() == CRAFT_OUT)
 	{
 		_globe->center(c->getLongitude(), c->getLatitude());
 		_game->popState();
@@ -22,7 +22,10 @@
 #include "../Engine/Action.h"
 #include "../Engine/Timer.h"
 #include "../Engine/Options.h"
+#include "../Engine/Profiler.h"
+#include "../Engine/Logger.h"
 #include "NumberText.h"
+#include "Text.h"
 
 namespace OpenXcom
 {
@@ -34,7 +37,7 @@ namespace OpenXcom
  * @param x X position in pixels.
  * @param y Y position in pixels.
  */
-FpsCounter::FpsCounter(int width, int height, int x, int y) : Surface(width, height, x, y), _frames(0)
+FpsCounter::FpsCounter(int width, int height, int x, int y) : Surface(width, height, x, y), _profile(0), _frames(0)
 {
 	_visible = Options::fpsCounter;
 
@@ -51,6 +54,7 @@ FpsCounter::FpsCounter(int width, int height, int x, int y) : Surface(width, hei
 FpsCounter::~FpsCounter()
 {
 	delete _text;
+	delete _profile;
 	delete _timer;
 }
 
@@ -64,6 +68,10 @@ void FpsCounter::setPalette(const SDL_Color *colors, int firstcolor, int ncolors
 {
 	Surface::setPalette(colors, firstcolor, ncolors);
 	_text->setPalette(colors, firstcolor, ncolors);
+	if (_profile)
+	{
+		_profile->setPalette(colors, firstcolor, ncolors);
+	}
 }
 
 /**
@@ -73,16 +81,58 @@ void FpsCounter::setPalette(const SDL_Color *colors, int firstcolor, int ncolors
 void FpsCounter::setColor(Uint8 color)
 {
 	_text->setColor(color);
+	if (_profile)
+	{
+		_profile->setColor(color);
+	}
+}
+
+/**
+ * Creates the profiler report once the game fonts are available,
+ * and points it at the current fonts again every time after, since
+ * reloading mods or languages replaces them.
+ * @param big Pointer to large-size font.
+ * @param small Pointer to small-size font.
+ * @param lang Pointer to current language.
+ */
+void FpsCounter::initText(Font *big, Font *small, Language *lang)
+{
+	if (!_profile)
+	{
+		_profile = new Text(200, 120, getX(), getY() + getHeight() + 1);
+		_profile->setHighContrast(true);
+		_profile->setPalette(getPalette());
+	}
+	_profile->initText(big, small, lang);
 }
 
 /**
  * Shows / hides the FPS counter.
+ * With Ctrl held, starts / stops profiling instead. Stopping it writes the
+ * timed sections to a trace file in the user folder.
  * @param action Pointer to an action.
  */
 void FpsCounter::handle(Action *action)
 {
 	if (action->getDetails()->type == SDL_KEYDOWN && action->getDetails()->key.keysym.sym == Options::keyFps)
 	{
+		if (action->getDetails()->key.keysym.mod & KMOD_CTRL)
+		{
+			if (Profiler::isEnabled())
+			{
+				Profiler::setEnabled(false);
+				std::string filepath = Options::getMasterUserFolder() + "profile_trace.json";
+				if (!Profiler::saveTrace(filepath))
+				{
+					Log(LOG_WARNING) << "Failed to save " << filepath;
+				}
+			}
+			else
+			{
+				Profiler::setEnabled(true);
+			}
+			return;
+		}
 		_visible = !_visible;
 		Options::fpsCounter = _visible;
 	}
@@ -105,6 +155,10 @@ void FpsCounter::update()
 	_text->setValue(fps);
 	_frames = 0;
 	_redraw = true;
+	if (_profile && Profiler::isEnabled())
+	{
+		_profile->setText(Profiler::getReport());
+	}
 }
 
 /**
@@ -116,6 +170,19 @@ void FpsCounter::draw()
 	_text->blit(this->getSurface());
 }
 
+/**
+ * Blits the FPS counter, and the profiler report while profiling.
+ * @param surface Pointer to surface to blit onto.
+ */
+void FpsCounter::blit(SDL_Surface *surface)
+{
+	Surface::blit(surface);
+	if (_profile && Profiler::isEnabled())
+	{
+		_profile->blit(surface);
+	}
+}
+
 void FpsCounter::addFrame()
 {
 	_frames++;
@@ -23,17 +23,20 @@ namespace OpenXcom
 {
 
 class NumberText;
+class Text;
 class Timer;
 class Action;
 
 /**
  * Counts the amount of frames each second
  * and displays them in a NumberText surface.
+ * While profiling is enabled, also shows the time of each profiled section.
  */
 class FpsCounter : public Surface
 {
 private:
 	NumberText *_text;
+	Text *_profile;
 	Timer *_timer;
 	int _frames;
 public:
@@ -45,6 +48,8 @@ public:
 	void setPalette(const SDL_Color *colors, int firstcolor = 0, int ncolors = 256) override;
 	/// Sets the FpsCounter's color.
 	void setColor(Uint8 color) override;
+	/// Sets the fonts of the profiler report.
+	void initText(Font *big, Font *small, Language *lang) override;
 	/// Handles keyboard events.
 	void handle(Action *action);
 	/// Advances frame counter.
@@ -53,6 +58,8 @@ public:
 	void update();
 	/// Draws the FPS counter.
 	void draw() override;
+	/// Blits the FPS counter and the profiler report.
+	void blit(SDL_Surface *surface) override;
 	void addFrame();
 };
 
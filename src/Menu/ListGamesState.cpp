@@ -178,6 +178,12 @@ void ListGamesState::init()
 		applyBattlescapeTheme("saveMenus");
 	}
 
+	std::string saveError = _game->waitForSave();
+	if (!saveError.empty())
+	{
+		Log(LOG_ERROR) << saveError;
+	}
+
 	try
 	{
 		_saves = SavedGame::getList(_game->getLanguage(), _autoquick);
@@ -162,6 +162,13 @@ void LoadGameState::think()
 		// Reset touch flags
 		_game->resetTouchButtonFlags();
 
+		// Make sure the save is not still being written
+		std::string saveError = _game->waitForSave();
+		if (!saveError.empty())
+		{
+			Log(LOG_ERROR) << saveError;
+		}
+
 		// Load the game
 		SavedGame *s = new SavedGame();
 		try
@@ -363,7 +363,7 @@ void NewBattleState::load(const std::string &filename)
 				}
 
 				// Generate items
-				base->getStorageItems()->getContents()->clear();
+				base->getStorageItems()->clear();
 				for (auto& itemType : mod->getItemsList())
 				{
 					RuleItem *rule = _game->getMod()->getItem(itemType);
@@ -383,12 +383,12 @@ void NewBattleState::load(const std::string &filename)
 				else
 				{
 					_craft = base->getCrafts()->front();
-					for (auto& pair : *_craft->getItems()->getContents())
+					for (const auto& entry : *_craft->getItems())
 					{
-						RuleItem *rule = _game->getMod()->getItem(pair.first);
+						RuleItem *rule = _game->getMod()->getItemByTypeIndex(entry.index);
 						if (!rule)
 						{
-							pair.second = 0;
+							_craft->getItems()->removeItem(entry.type, entry.qty);
 						}
 					}
 				}
@@ -458,7 +458,7 @@ void NewBattleState::initSave()
 		delete xcraft;
 	}
 	base->getCrafts()->clear();
-	base->getStorageItems()->getContents()->clear();
+	base->getStorageItems()->clear();
 
 	_craft = new Craft(mod->getCraft(_crafts[_cbxCraft->getSelected()]), base, 1);
 	base->getCrafts()->push_back(_craft);
@@ -24,6 +24,7 @@
 #include "../Engine/Options.h"
 #include "../Engine/Screen.h"
 #include "../Engine/CrossPlatform.h"
+#include "../Engine/Language.h"
 #include "../Engine/LocalizedText.h"
 #include "../Engine/Unicode.h"
 #include "../Interface/Text.h"
@@ -165,16 +166,31 @@ void SaveGameState::think()
 			break;
 		}
 
+		// Report if the previous background save failed
+		std::string previousError = _game->waitForSave();
+		if (!previousError.empty())
+		{
+			error(previousError);
+		}
+
 		// Save the game
 		try
 		{
-			std::string backup = _filename + ".bak";
-			_game->getSavedGame()->save(backup, _game->getMod());
-			std::string fullPath = Options::getMasterUserFolder() + _filename;
-			std::string bakPath = Options::getMasterUserFolder() + backup;
-			if (!CrossPlatform::moveFile(bakPath, fullPath))
+			if (_type == SAVE_AUTO_GEOSCAPE || _type == SAVE_AUTO_BATTLESCAPE || _type == SAVE_IRONMAN)
 			{
-				throw Exception("Save backed up in " + backup);
+				// automatic saves only take a snapshot, the file is written in the background
+				_game->saveInBackground(_filename);
+			}
+			else
+			{
+				std::string backup = _filename + ".bak";
+				_game->getSavedGame()->save(backup, _game->getMod());
+				std::string fullPath = Options::getMasterUserFolder() + _filename;
+				std::string bakPath = Options::getMasterUserFolder() + backup;
+				if (!CrossPlatform::moveFile(bakPath, fullPath))
+				{
+					throw Exception("Save backed up in " + backup);
+				}
 			}
 
 			if (_type == SAVE_IRONMAN_END)
@@ -209,14 +225,27 @@ void SaveGameState::think()
  * @param msg Error message.
  */
 void SaveGameState::error(const std::string &msg)
+{
+	showError(_game, msg, _palette, _origin == OPT_BATTLESCAPE);
+}
+
+/**
+ * Logs and shows an error message for a failed save,
+ * also used when a save written in the background fails.
+ * @param game Pointer to the core game.
+ * @param msg Error message.
+ * @param palette Palette of the state on top.
+ * @param battlescape Is the error shown in the battlescape?
+ */
+void SaveGameState::showError(Game *game, const std::string &msg, SDL_Color *palette, bool battlescape)
 {
 	Log(LOG_ERROR) << msg;
 	std::ostringstream error;
-	error << tr("STR_SAVE_UNSUCCESSFUL") << Unicode::TOK_NL_SMALL << msg;
-	if (_origin != OPT_BATTLESCAPE)
-		_game->pushState(new ErrorMessageState(error.str(), _palette, _game->getMod()->getInterface("errorMessages")->getElement("geoscapeColor")->color, "BACK01.SCR", _game->getMod()->getInterface("errorMessages")->getElement("geoscapePalette")->color));
+	error << game->getLanguage()->getString("STR_SAVE_UNSUCCESSFUL") << Unicode::TOK_NL_SMALL << msg;
+	if (!battlescape)
+		game->pushState(new ErrorMessageState(error.str(), palette, game->getMod()->getInterface("errorMessages")->getElement("geoscapeColor")->color, "BACK01.SCR", game->getMod()->getInterface("errorMessages")->getElement("geoscapePalette")->color));
 	else
-		_game->pushState(new ErrorMessageState(error.str(), _palette, _game->getMod()->getInterface("errorMessages")->getElement("battlescapeColor")->color, "TAC00.SCR", _game->getMod()->getInterface("errorMessages")->getElement("battlescapePalette")->color));
+		game->pushState(new ErrorMessageState(error.str(), palette, game->getMod()->getInterface("errorMessages")->getElement("battlescapeColor")->color, "TAC00.SCR", game->getMod()->getInterface("errorMessages")->getElement("battlescapePalette")->color));
 }
 
 }
@@ -52,6 +52,8 @@ public:
 	void think() override;
 	/// Shows an error message.
 	void error(const std::string &msg);
+	/// Shows an error message for a failed save.
+	static void showError(Game *game, const std::string &msg, SDL_Color *palette, bool battlescape);
 };
 
 }
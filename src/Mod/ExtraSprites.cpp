@@ -18,6 +18,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include "ExtraSprites.h"
 #include "../Engine/Surface.h"
 #include "../Engine/SurfaceSet.h"
@@ -25,11 +26,65 @@
 #include "../Engine/Logger.h"
 #include "../Engine/Exception.h"
 #include "../Engine/Unicode.h"
+#include "../Engine/Options.h"
 #include "Mod.h"
 
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Checks the header of an image file deferred by lazy loading,
+ * so files that would fail to load are caught up front
+ * like they are when all images are loaded right away.
+ * Only formats that can hold 8bit images are accepted.
+ * @param filename Image filename.
+ * @return True if the file looks loadable, also when it's missing
+ *  (that is logged by FileMap and gives an empty frame either way).
+ */
+bool isLoadableImageHeader(const std::string &filename)
+{
+	SDL_RWops *rw = FileMap::getRWops(filename);
+	if (!rw)
+	{
+		return true;
+	}
+	Uint8 h[66] = { };
+	size_t size = SDL_RWread(rw, h, 1, sizeof(h));
+	SDL_RWclose(rw);
+
+	static const Uint8 png[] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+	if (size >= 26 && std::equal(std::begin(png), std::end(png), h))
+	{
+		// IHDR bit depth and color type
+		return h[25] == 3 || (h[25] == 0 && h[24] <= 8);
+	}
+	if (size >= 4 && (!memcmp(h, "GIF8", 4) || !memcmp(h, "FORM", 4) || !memcmp(h, "II*\0", 4) || !memcmp(h, "MM\0*", 4)))
+	{
+		return true;
+	}
+	if (size >= 30 && h[0] == 'B' && h[1] == 'M')
+	{
+		// bits per pixel
+		return (h[28] | (h[29] << 8)) <= 8;
+	}
+	if (size >= 66 && h[0] == 0x0A)
+	{
+		// PCX color planes
+		return h[65] == 1;
+	}
+	if (size >= 18 && CrossPlatform::compareExt(filename, "TGA"))
+	{
+		// color mapped or grayscale, raw or RLE
+		return h[2] == 1 || h[2] == 3 || h[2] == 9 || h[2] == 11;
+	}
+	return false;
+}
+
+}
+
 /**
  * Creates a blank set of extra sprite data.
  */
@@ -239,6 +294,17 @@ SurfaceSet *ExtraSprites::loadSurfaceSet(SurfaceSet *set)
 			{
 				if (!isImageFile(name))
 					continue;
+				if (Options::lazyLoadResources)
+				{
+					if (!isLoadableImageHeader(fileName + name))
+					{
+						Log(LOG_WARNING) << fileName + name << ": not a supported 8bit image.";
+						continue;
+					}
+					set->setLazyFrame(getFrameIndex(set, offset), fileName + name);
+					offset++;
+					continue;
+				}
 				try
 				{
 					getFrame(set, offset)->loadImage(fileName + name);
@@ -254,7 +320,18 @@ SurfaceSet *ExtraSprites::loadSurfaceSet(SurfaceSet *set)
 		{
 			if (!subdivision)
 			{
-				getFrame(set, startFrame)->loadImage(fileName);
+				if (Options::lazyLoadResources)
+				{
+					if (!isLoadableImageHeader(fileName))
+					{
+						throw Exception(fileName + ": not a supported 8bit image.");
+					}
+					set->setLazyFrame(getFrameIndex(set, startFrame), fileName);
+				}
+				else
+				{
+					getFrame(set, startFrame)->loadImage(fileName);
+				}
 			}
 			else
 			{
@@ -282,7 +359,7 @@ SurfaceSet *ExtraSprites::loadSurfaceSet(SurfaceSet *set)
 	return set;
 }
 
-Surface *ExtraSprites::getFrame(SurfaceSet *set, int index) const
+int ExtraSprites::getFrameIndex(SurfaceSet *set, int index) const
 {
 	int indexWithOffset = index;
 	if (indexWithOffset >= set->getMaxSharedFrames())
@@ -301,7 +378,13 @@ Surface *ExtraSprites::getFrame(SurfaceSet *set, int index) const
 		err << "ExtraSprites '" << _type << "' frame '" << indexWithOffset << "' in mod '" << _current->name << "' is not allowed.";
 		throw Exception(err.str());
 	}
+	return indexWithOffset;
+}
 
+Surface *ExtraSprites::getFrame(SurfaceSet *set, int index) const
+{
+	int indexWithOffset = getFrameIndex(set, index);
+	set->forgetLazyFrame(indexWithOffset);
 	Surface *frame = set->getFrame(indexWithOffset);
 	if (frame)
 	{
@@ -42,6 +42,7 @@ private:
 	int _subX, _subY;
 	bool _loaded;
 
+	int getFrameIndex(SurfaceSet *set, int index) const;
 	Surface *getFrame(SurfaceSet *set, int index) const;
 public:
 	/// Creates a blank external sprite set.
@@ -18,9 +18,11 @@
  */
 #include <sstream>
 #include <algorithm>
+#include <iterator>
 #include "MapBlock.h"
 #include "../Battlescape/Position.h"
 #include "../Engine/Exception.h"
+#include "../Engine/FileMap.h"
 
 namespace YAML
 {
@@ -54,10 +56,26 @@ namespace YAML
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Reads a whole file from the virtual file system.
+ * @param filename Relative path of the file.
+ * @param data Buffer for the contents.
+ */
+void readWholeFile(const std::string &filename, std::vector<char> &data)
+{
+	auto file = FileMap::getIStream(filename);
+	data.assign(std::istreambuf_iterator<char>(*file), std::istreambuf_iterator<char>());
+}
+
+}
+
 /**
  * MapBlock construction.
  */
-MapBlock::MapBlock(const std::string &name): _name(name), _size_x(10), _size_y(10), _size_z(4)
+MapBlock::MapBlock(const std::string &name): _name(name), _size_x(10), _size_y(10), _size_z(4), _mapFileLoaded(false), _routeFileLoaded(false)
 {
 	_groups.push_back(0);
 }
@@ -203,4 +221,33 @@ const std::map<std::string, std::pair<int, int> > *MapBlock::getItemsFuseTimers(
 	return &_itemsFuseTimer;
 }
 
+/**
+ * Gets the contents of the MAP file of this block.
+ * The file is read on first use and kept, so later missions using this block do not read it again.
+ * @return Raw contents of the file.
+ */
+const std::vector<char> &MapBlock::getMapFile()
+{
+	if (!_mapFileLoaded)
+	{
+		readWholeFile("MAPS/" + _name + ".MAP", _mapFile);
+		_mapFileLoaded = true;
+	}
+	return _mapFile;
+}
+
+/**
+ * Gets the contents of the RMP file of this block.
+ * @return Raw contents of the file.
+ */
+const std::vector<char> &MapBlock::getRouteFile()
+{
+	if (!_routeFileLoaded)
+	{
+		readWholeFile("ROUTES/" + _name + ".RMP", _routeFile);
+		_routeFileLoaded = true;
+	}
+	return _routeFile;
+}
+
 }
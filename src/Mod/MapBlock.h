@@ -52,6 +52,8 @@ private:
 	std::map<std::string, std::vector<Position> > _items;
 	std::vector<RandomizedItems> _randomizedItems;
 	std::map<std::string, std::pair<int, int> > _itemsFuseTimer;
+	std::vector<char> _mapFile, _routeFile;
+	bool _mapFileLoaded, _routeFileLoaded;
 public:
 	MapBlock(const std::string &name);
 	~MapBlock();
@@ -77,6 +79,10 @@ public:
 	const std::vector<RandomizedItems> *getRandomizedItems() const;
 	/// Gets the fuse timer for any items that belong in this map block.
 	const std::map<std::string, std::pair<int, int> > *getItemsFuseTimers() const;
+	/// Gets the contents of the MAP file of this block.
+	const std::vector<char> &getMapFile();
+	/// Gets the contents of the RMP file of this block.
+	const std::vector<char> &getRouteFile();
 
 };
 
@@ -145,6 +145,8 @@ struct OxceVersionDate
 	}
 };
 
+/// Generation of the last created mod, see Mod::getGeneration.
+int lastModGeneration = 0;
 
 } //namespace
 
@@ -418,7 +420,7 @@ Mod::Mod() :
 	_baseDefenseMapFromLocation(0), _disableUnderwaterSounds(false), _enableUnitResponseSounds(false), _pediaReplaceCraftFuelWithRangeType(-1),
 	_facilityListOrder(0), _craftListOrder(0), _itemCategoryListOrder(0), _itemListOrder(0),
 	_researchListOrder(0),  _manufactureListOrder(0), _soldierBonusListOrder(0), _transformationListOrder(0), _ufopaediaListOrder(0), _invListOrder(0), _soldierListOrder(0),
-	_modCurrent(0), _statePalette(0)
+	_modCurrent(0), _statePalette(0), _generation(++lastModGeneration)
 {
 	_muteMusic = new Music();
 	_muteSound = new Sound();
@@ -812,6 +814,39 @@ T *Mod::getRule(const std::string &id, const std::string &name, const std::map<s
 	}
 }
 
+/**
+ * Gets a rule element by name using the hashed copy of the map.
+ * Before the copy is filled (i.e. while loading) the ordered map is used.
+ * @param id String ID of the rule element.
+ * @param name Human-readable name of the rule type.
+ * @param hashed Hashed copy of the map.
+ * @param map Map associated to the rule type.
+ * @param error Throw exception if not found.
+ * @return Pointer to the rule element, or NULL if not found.
+ */
+template <typename T>
+T *Mod::getRule(const std::string &id, const std::string &name, const std::unordered_map<std::string, T*> &hashed, const std::map<std::string, T*> &map, bool error) const
+{
+	if (hashed.empty())
+	{
+		return getRule(id, name, map, error);
+	}
+	if (isEmptyRuleName(id))
+	{
+		return 0;
+	}
+	auto i = hashed.find(id);
+	if (i != hashed.end())
+	{
+		return i->second;
+	}
+	if (error)
+	{
+		throw Exception(name + " " + id + " not found");
+	}
+	return 0;
+}
+
 /**
  * Returns a specific font from the mod.
  * @param name Name of the font.
@@ -864,6 +899,59 @@ SurfaceSet *Mod::getSurfaceSet(const std::string &name, bool error)
 	return getRule(name, "Sprite Set", _sets, error);
 }
 
+/**
+ * Frees the lazily loaded sprite set frames that were drawn the longest
+ * time ago, once all of them together take more memory than allowed.
+ * Trims well below the limit, so it doesn't happen again every frame.
+ * Frames drawn in the current frame tick are never freed.
+ * @param maxBytes Memory limit for lazily loaded frames.
+ */
+void Mod::trimSpriteCache(size_t maxBytes)
+{
+	size_t total = 0;
+	for (const auto& pair : _sets)
+	{
+		total += pair.second->getLazyFramesBytes();
+	}
+	if (total <= maxBytes)
+	{
+		return;
+	}
+
+	struct Candidate
+	{
+		Uint32 lastUse;
+		int frame;
+		SurfaceSet *set;
+	};
+	std::vector<Candidate> candidates;
+	std::vector<std::pair<Uint32, int>> frames;
+	for (const auto& pair : _sets)
+	{
+		frames.clear();
+		pair.second->listUnusedLazyFrames(frames);
+		for (const auto& f : frames)
+		{
+			candidates.push_back({ f.first, f.second, pair.second });
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) { return a.lastUse < b.lastUse; });
+
+	const size_t target = maxBytes / 4 * 3;
+	size_t freed = 0;
+	int count = 0;
+	for (const auto& c : candidates)
+	{
+		if (total - freed <= target)
+		{
+			break;
+		}
+		freed += c.set->freeLazyFrame(c.frame);
+		++count;
+	}
+	Log(LOG_VERBOSE) << "Sprite cache over " << maxBytes << " bytes, freed " << count << " frames (" << freed << " bytes).";
+}
+
 /**
  * Returns a specific music from the mod.
  * @param name Name of the music.
@@ -2093,6 +2181,7 @@ void Mod::loadAll()
 {
 	ModScript parser{ _scriptGlobal, this };
 	const auto& mods = FileMap::getRulesets();
+	RuleStatBonus::clearSharedScripts();
 
 	Log(LOG_INFO) << "Loading begins...";
 	if (Options::oxceModValidationLevel < LOG_ERROR)
@@ -2241,6 +2330,40 @@ void Mod::loadAll()
 	afterLoadHelper("craftWeapons", this, _craftWeapons, &RuleCraftWeapon::afterLoad);
 	afterLoadHelper("countries", this, _countries, &RuleCountry::afterLoad);
 
+	// assign dense type indexes to items, names from previous mod lists keep their old indexes
+	{
+		auto& table = RuleItem::getTypeIndexTable();
+		for (auto& pair : _items)
+		{
+			pair.second->setTypeIndex((int)table.addName(pair.first, INT_MAX));
+		}
+		_itemsByTypeIndex.clear();
+		_itemsByTypeIndex.resize(table.size(), nullptr);
+		for (auto& pair : _items)
+		{
+			_itemsByTypeIndex[pair.second->getTypeIndex()] = pair.second;
+		}
+	}
+
+	// hashed lookups for rules asked for by name in geoscape ticks and battle setup
+	{
+		auto fillHashed = [](auto &hashed, const auto &map)
+		{
+			hashed.clear();
+			hashed.reserve(map.size());
+			for (auto& pair : map)
+			{
+				if (pair.second)
+				{
+					hashed.emplace(pair.first, pair.second);
+				}
+			}
+		};
+		fillHashed(_researchByName, _research);
+		fillHashed(_unitsByName, _units);
+		fillHashed(_armorsByName, _armors);
+	}
+
 	for (auto& a : _armors)
 	{
 		if (a.second->hasInfiniteSupply())
@@ -2388,6 +2511,9 @@ void Mod::loadAll()
 
 	Log(LOG_INFO) << "Loading ended.";
 
+	// the parser goes away with this function, don't let another load reuse its scripts
+	RuleStatBonus::clearSharedScripts();
+
 	sortLists();
 	modResources();
 }
@@ -4016,9 +4142,46 @@ RuleItem *Mod::getItem(const std::string &id, bool error) const
 	{
 		return 0;
 	}
+	if (!_itemsByTypeIndex.empty())
+	{
+		// items have dense type indexes, use them instead of the ordered map
+		if (isEmptyRuleName(id))
+		{
+			return 0;
+		}
+		size_t typeIndex = RuleItem::getTypeIndexTable().getIndex(id);
+		if (typeIndex > 0 && typeIndex < _itemsByTypeIndex.size() && _itemsByTypeIndex[typeIndex])
+		{
+			return _itemsByTypeIndex[typeIndex];
+		}
+		if (error)
+		{
+			throw Exception("Item " + id + " not found");
+		}
+		return 0;
+	}
 	return getRule(id, "Item", _items, error);
 }
 
+/**
+ * Returns the rules for the specified item type index.
+ * @param typeIndex Item type index, see RuleItem::getTypeIndexTable().
+ * @param error Throw when the index doesn't belong to any loaded item.
+ * @return Rules for the item, or 0 when the item is not loaded.
+ */
+RuleItem *Mod::getItemByTypeIndex(int typeIndex, bool error) const
+{
+	if (typeIndex > 0 && typeIndex < (int)_itemsByTypeIndex.size() && _itemsByTypeIndex[typeIndex])
+	{
+		return _itemsByTypeIndex[typeIndex];
+	}
+	if (error)
+	{
+		throw Exception("Item " + RuleItem::getTypeIndexTable().getName(typeIndex) + " not found");
+	}
+	return 0;
+}
+
 /**
  * Returns the list of all items
  * provided by the mod.
@@ -4145,7 +4308,7 @@ const std::map<std::string, RuleCommendations *> &Mod::getCommendationsList() co
  */
 Unit *Mod::getUnit(const std::string &name, bool error) const
 {
-	return getRule(name, "Unit", _units, error);
+	return getRule(name, "Unit", _unitsByName, _units, error);
 }
 
 /**
@@ -4238,7 +4401,7 @@ const std::vector<std::string> &Mod::getDeploymentsList() const
  */
 Armor *Mod::getArmor(const std::string &name, bool error) const
 {
-	return getRule(name, "Armor", _armors, error);
+	return getRule(name, "Armor", _armorsByName, _armors, error);
 }
 
 /**
@@ -4407,7 +4570,7 @@ const std::vector<std::string> &Mod::getInvsList() const
  */
 RuleResearch *Mod::getResearch(const std::string &id, bool error) const
 {
-	return getRule(id, "Research", _research, error);
+	return getRule(id, "Research", _researchByName, _research, error);
 }
 
 /**
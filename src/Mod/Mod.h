@@ -171,6 +171,7 @@ private:
 	std::map<std::string, RuleCraftWeapon*> _craftWeapons;
 	std::map<std::string, RuleItemCategory*> _itemCategories;
 	std::map<std::string, RuleItem*> _items;
+	std::vector<RuleItem*> _itemsByTypeIndex;
 	std::map<std::string, RuleUfo*> _ufos;
 	std::map<std::string, RuleTerrain*> _terrains;
 	std::map<std::string, MapDataSet*> _mapDataSets;
@@ -186,6 +187,10 @@ private:
 	std::map<std::string, RuleInventory*> _invs;
 	bool _inventoryOverlapsPaperdoll;
 	std::map<std::string, RuleResearch *> _research;
+	/// Hashed copies of the most looked up rule maps, filled once loading is done.
+	std::unordered_map<std::string, RuleResearch *> _researchByName;
+	std::unordered_map<std::string, Unit*> _unitsByName;
+	std::unordered_map<std::string, Armor*> _armorsByName;
 	std::map<std::string, RuleManufacture *> _manufacture;
 	std::map<std::string, RuleManufactureShortcut *> _manufactureShortcut;
 	std::map<std::string, RuleSoldierBonus *> _soldierBonus;
@@ -307,6 +312,7 @@ private:
 	std::vector<ModData> _modData;
 	ModData* _modCurrent;
 	const SDL_Color *_statePalette;
+	int _generation;
 
 	std::vector<std::string> _psiRequirements; // it's a cache for psiStrengthEval
 	std::vector<const Armor*> _armorsForSoldiersCache;
@@ -352,6 +358,9 @@ private:
 	/// Gets a ruleset element.
 	template <typename T>
 	T *getRule(const std::string &id, const std::string &name, const std::map<std::string, T*> &map, bool error) const;
+	/// Gets a ruleset element using its hashed copy when available.
+	template <typename T>
+	T *getRule(const std::string &id, const std::string &name, const std::unordered_map<std::string, T*> &hashed, const std::map<std::string, T*> &map, bool error) const;
 	/// Gets a random music. This is private to prevent access, use playMusic(name, true) instead.
 	Music *getRandomMusic(const std::string &name) const;
 	/// Gets a particular sound set. This is private to prevent access, use getSound(name, id) instead.
@@ -457,6 +466,8 @@ public:
 	Surface *getSurface(const std::string &name, bool error = true);
 	/// Gets a particular surface set.
 	SurfaceSet *getSurfaceSet(const std::string &name, bool error = true);
+	/// Frees the least recently drawn lazily loaded sprites over a memory limit.
+	void trimSpriteCache(size_t maxBytes);
 	/// Gets a particular music.
 	Music *getMusic(const std::string &name, bool error = true) const;
 	/// Gets the available music tracks.
@@ -532,6 +543,8 @@ public:
 
 	/// Gets the mod offset.
 	int getModOffset() const;
+	/// Gets the number telling this mod apart from the ones loaded before it.
+	int getGeneration() const { return _generation; }
 	/// Get offset and index for sound set or sprite set.
 	void loadOffsetNode(const std::string &parent, int& offset, const YAML::Node &node, int shared, const std::string &set, size_t multiplier, size_t sizeScale = 1) const;
 	/// Gets the mod offset for a certain sprite.
@@ -701,6 +714,8 @@ public:
 	const std::vector<std::string> &getItemCategoriesList() const;
 	/// Gets the ruleset for an item type.
 	RuleItem *getItem(const std::string &id, bool error = false) const;
+	/// Gets the ruleset for an item type index.
+	RuleItem *getItemByTypeIndex(int typeIndex, bool error = false) const;
 	/// Gets the available items.
 	const std::vector<std::string> &getItemsList() const;
 	/// Gets the ruleset for a UFO type.
@@ -809,6 +809,18 @@ const std::string &RuleItem::getType() const
 	return _type;
 }
 
+/**
+ * Gets the table mapping item types to the dense indexes used by item containers.
+ * Indexes are assigned by Mod after loading rulesets and never change,
+ * even when the mod list is reloaded. Zero is reserved for "no item".
+ * @return Shared table of item type names.
+ */
+Collections::NamesToIndex &RuleItem::getTypeIndexTable()
+{
+	static Collections::NamesToIndex table;
+	return table;
+}
+
 /**
  * Gets the language string that names
  * this item. This is not necessarily unique.
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <yaml-cpp/yaml.h>
 #include "LoadYaml.h"
+#include "../Engine/Collections.h"
 #include "RuleStatBonus.h"
 #include "RuleDamageType.h"
 #include "ModScript.h"
@@ -280,6 +281,7 @@ public:
 private:
 	std::string _ufopediaType;
 	std::string _type, _name, _nameAsAmmo; // two types of objects can have the same name
+	int _typeIndex = 0;
 	std::string _requiresBuyCountry;
 	std::vector<std::string> _requiresName;
 	std::vector<std::string> _requiresBuyName;
@@ -420,6 +422,12 @@ public:
 
 	/// Gets the item's type.
 	const std::string &getType() const;
+	/// Gets the item's dense type index used by item containers.
+	int getTypeIndex() const { return _typeIndex; }
+	/// Sets the item's dense type index.
+	void setTypeIndex(int typeIndex) { _typeIndex = typeIndex; }
+	/// Gets the table of all item type names known to item containers.
+	static Collections::NamesToIndex &getTypeIndexTable();
 	/// Gets the item's name.
 	const std::string &getName() const;
 	/// Gets the item's name when loaded in weapon.
@@ -24,6 +24,7 @@
 #include "../Savegame/BattleUnit.h"
 #include "../Savegame/BattleItem.h"
 #include "../fmath.h"
+#include <map>
 
 namespace OpenXcom
 {
@@ -277,6 +278,25 @@ RuleStatBonus::RuleStatBonus()
 {
 
 }
+namespace
+{
+
+/**
+ * Bonus scripts generated from stat values, by parser and script text.
+ * Most rules use the same few default bonuses, so they all share one compiled copy.
+ */
+std::map<std::pair<const ModScript::BonusStatsCommon*, std::string>, std::shared_ptr<const ModScript::BonusStatsCommon::Container>> sharedScripts;
+
+}
+
+/**
+ * Forgets the shared generated scripts. Rules keep the scripts they already use.
+ */
+void RuleStatBonus::clearSharedScripts()
+{
+	sharedScripts.clear();
+}
+
 /**
  * Loads the item from a YAML file.
  * @param node YAML node.
@@ -318,7 +338,9 @@ void RuleStatBonus::load(const std::string& parentName, const YAML::Node& node,
 			}
 			else if (stats.IsScalar())
 			{
-				_container.load(parentName, stats.as<std::string>(), parser);
+				auto container = std::make_shared<ModScript::BonusStatsCommon::Container>();
+				container->load(parentName, stats.as<std::string>(), parser);
+				_container = std::move(container);
 				_refresh = false;
 			}
 			// let's remember that this was modified by a modder (i.e. is not a default value)
@@ -363,7 +385,14 @@ void RuleStatBonus::load(const std::string& parentName, const YAML::Node& node,
 			script += "div bonus 1000;\n";
 		}
 		script += "return bonus;";
-		_container.load(parentName, script, parser);
+		auto& shared = sharedScripts[std::make_pair(&parser, script)];
+		if (!shared)
+		{
+			auto container = std::make_shared<ModScript::BonusStatsCommon::Container>();
+			container->load(parentName, script, parser);
+			shared = std::move(container);
+		}
+		_container = shared;
 		_refresh = false;
 	}
 }
@@ -520,7 +549,10 @@ int RuleStatBonus::getBonus(BattleActionAttack::ReadOnly attack, int externalBon
 
 	ModScript::BonusStatsCommon::Output arg{ externalBonuses };
 	ModScript::BonusStatsCommon::Worker work{ attack.attacker, externalBonuses, attack.weapon_item, attack.damage_item, attack.type, attack.skill_rules };
-	work.execute(_container, arg);
+	if (_container)
+	{
+		work.execute(*_container, arg);
+	}
 
 	return arg.getFirst();
 }
@@ -534,7 +566,10 @@ int RuleStatBonus::getBonus(const BattleUnit* unit, int externalBonuses) const
 
 	ModScript::BonusStatsCommon::Output arg{ externalBonuses };
 	ModScript::BonusStatsCommon::Worker work{ unit, externalBonuses, nullptr, nullptr, BA_NONE, nullptr };
-	work.execute(_container, arg);
+	if (_container)
+	{
+		work.execute(*_container, arg);
+	}
 
 	return arg.getFirst();
 }
@@ -19,6 +19,7 @@
  */
 #include <vector>
 #include <string>
+#include <memory>
 #include "ModScript.h"
 
 namespace OpenXcom
@@ -35,7 +36,8 @@ typedef std::pair<std::string, std::vector<float> > RuleStatBonusDataOrig;
  */
 class RuleStatBonus
 {
-	ModScript::BonusStatsCommon::Container _container;
+	/// Compiled script, shared by all bonuses generated from the same values.
+	std::shared_ptr<const ModScript::BonusStatsCommon::Container> _container;
 	std::vector<RuleStatBonusDataOrig> _bonusOrig;
 	bool _modded = false;
 	bool _refresh = true;
@@ -77,6 +79,8 @@ public:
 	const std::vector<RuleStatBonusDataOrig> *getBonusRaw() const { return &_bonusOrig; }
 	bool isModded() const { return _modded; }
 	void setModded(bool modded) { _modded = modded; }
+	/// Forgets the scripts compiled during loading, so later loads don't share them.
+	static void clearSharedScripts();
 };
 
 }
@@ -168,16 +168,12 @@ void Base::load(const YAML::Node &node, SavedGame *save, bool newGame, bool newB
 
 	_items->load(node["items"]);
 	// Some old saves have bad items, better get rid of them to avoid further bugs
-	for (auto iter = _items->getContents()->begin(); iter != _items->getContents()->end();)
+	for (const auto& entry : *_items)
 	{
-		if (_mod->getItem(iter->first) == 0)
+		if (_mod->getItemByTypeIndex(entry.index) == 0)
 		{
-			Log(LOG_ERROR) << "Failed to load item " << iter->first;
-			_items->getContents()->erase(iter++);
-		}
-		else
-		{
-			++iter;
+			Log(LOG_ERROR) << "Failed to load item " << entry.type;
+			_items->removeItem(entry.type, entry.qty);
 		}
 	}
 
@@ -573,7 +569,7 @@ int Base::getAvailableSoldiers(bool checkCombatReadiness, bool includeWounded) c
 		{
 			total++;
 		}
-		else if (checkCombatReadiness && ((soldier->getCraft() != 0 && soldier->getCraft()->getStatus() != "STR_OUT") ||
+		else if (checkCombatReadiness && ((soldier->getCraft() != 0 && soldier->getCraft()->getStatus() != CRAFT_OUT) ||
 			(soldier->getCraft() == 0 && (soldier->hasFullHealth() || (includeWounded && soldier->canDefendBase())))))
 		{
 			total++;
@@ -705,34 +701,34 @@ int Base::getTotalOtherStaffAndInventoryCost(int& staffCount, int& inventoryCoun
 			}
 		}
 	}
-	for (const auto& storeItem : *_items->getContents())
+	for (const auto& storeItem : *_items)
 	{
-		auto* ruleItem = _mod->getItem(storeItem.first, true);
+		auto* ruleItem = _mod->getItemByTypeIndex(storeItem.index, true);
 		if (ruleItem->getMonthlySalary() != 0)
 		{
-			staffCount += storeItem.second;
-			totalCost += ruleItem->getMonthlySalary() * storeItem.second;
+			staffCount += storeItem.qty;
+			totalCost += ruleItem->getMonthlySalary() * storeItem.qty;
 		}
 		if (ruleItem->getMonthlyMaintenance() != 0)
 		{
-			inventoryCount += storeItem.second;
-			totalCost += ruleItem->getMonthlyMaintenance() * storeItem.second;
+			inventoryCount += storeItem.qty;
+			totalCost += ruleItem->getMonthlyMaintenance() * storeItem.qty;
 		}
 	}
 	for (auto* xcraft : _crafts)
 	{
-		for (const auto& craftItem : *xcraft->getItems()->getContents())
+		for (const auto& craftItem : *xcraft->getItems())
 		{
-			auto* ruleItem = _mod->getItem(craftItem.first, true);
+			auto* ruleItem = _mod->getItemByTypeIndex(craftItem.index, true);
 			if (ruleItem->getMonthlySalary() != 0)
 			{
-				staffCount += craftItem.second;
-				totalCost += ruleItem->getMonthlySalary() * craftItem.second;
+				staffCount += craftItem.qty;
+				totalCost += ruleItem->getMonthlySalary() * craftItem.qty;
 			}
 			if (ruleItem->getMonthlyMaintenance() != 0)
 			{
-				inventoryCount += craftItem.second;
-				totalCost += ruleItem->getMonthlyMaintenance() * craftItem.second;
+				inventoryCount += craftItem.qty;
+				totalCost += ruleItem->getMonthlyMaintenance() * craftItem.qty;
 			}
 		}
 		for (auto* vehicle : *xcraft->getVehicles())
@@ -1149,7 +1145,7 @@ int Base::getCraftCountForProduction(const RuleCraft *craft) const
 	int total = 0;
 	for (const auto* xcraft : _crafts)
 	{
-		if (xcraft->getRules() == craft && xcraft->getStatus() != "STR_OUT")
+		if (xcraft->getRules() == craft && xcraft->getStatus() != CRAFT_OUT)
 		{
 			total++;
 		}
@@ -1467,12 +1463,12 @@ int Base::getUsedContainment(int prisonType, bool onlyExternal) const
 		return total;
 	}
 
-	for (const auto& pair : *_items->getContents())
+	for (const auto& entry : *_items)
 	{
-		rule = _mod->getItem(pair.first, true);
+		rule = _mod->getItemByTypeIndex(entry.index, true);
 		if (rule->isAlien() && rule->getPrisonType() == prisonType)
 		{
-			total += pair.second;
+			total += entry.qty;
 		}
 	}
 	return total;
@@ -1592,7 +1588,7 @@ void Base::setupDefenses(AlienMission* am)
 	// add vehicles that are in the crafts of the base, if it's not out
 	for (auto* xcraft : _crafts)
 	{
-		if (xcraft->getStatus() != "STR_OUT")
+		if (xcraft->getStatus() != CRAFT_OUT)
 		{
 			for (auto* vehicle : *xcraft->getVehicles())
 			{
@@ -1602,11 +1598,10 @@ void Base::setupDefenses(AlienMission* am)
 	}
 
 	// add vehicles left on the base
-	for (auto iter = _items->getContents()->begin(); iter != _items->getContents()->end(); )
+	for (const auto& entry : _items->getSortedEntries())
 	{
-		const auto& itemId = iter->first;
-		int itemQty = iter->second;
-		RuleItem *rule = _mod->getItem(itemId, true);
+		int itemQty = entry.qty;
+		RuleItem *rule = _mod->getItemByTypeIndex(entry.index, true);
 		if (rule->getVehicleUnit())
 		{
 			int size = rule->getVehicleUnit()->getArmor()->getTotalSize();
@@ -1618,7 +1613,7 @@ void Base::setupDefenses(AlienMission* am)
 					_vehicles.push_back(vehicle);
 					_vehiclesFromBase.push_back(vehicle);
 				}
-				_items->removeItem(itemId, itemQty);
+				_items->removeItem(rule, itemQty);
 			}
 			else // so this vehicle needs ammo
 			{
@@ -1628,7 +1623,6 @@ void Base::setupDefenses(AlienMission* am)
 				int baseQty = _items->getItem(ammo) / ammoPerVehicle;
 				if (!baseQty)
 				{
-					++iter;
 					continue;
 				}
 				int canBeAdded = std::min(itemQty, baseQty);
@@ -1639,12 +1633,9 @@ void Base::setupDefenses(AlienMission* am)
 					_vehiclesFromBase.push_back(vehicle);
 					_items->removeItem(ammo, ammoPerVehicle);
 				}
-				_items->removeItem(itemId, canBeAdded);
+				_items->removeItem(rule, canBeAdded);
 			}
-
-			iter = _items->getContents()->begin(); // we have to start over because iterator is broken because of the removeItem
 		}
-		else ++iter;
 	}
 }
 
@@ -1883,12 +1874,12 @@ void Base::destroyFacility(BASEFACILITIESITERATOR facility)
 			}
 
 			// remove all items
-			while (!(*facility)->getCraftForDrawing()->getItems()->getContents()->empty())
+			auto* craftItems = (*facility)->getCraftForDrawing()->getItems();
+			for (const auto& entry : *craftItems)
 			{
-				auto i = (*facility)->getCraftForDrawing()->getItems()->getContents()->begin();
-				_items->addItem(i->first, i->second);
-				(*facility)->getCraftForDrawing()->getItems()->removeItem(i->first, i->second);
+				_items->addItem(entry.type, entry.qty);
 			}
+			craftItems->clear();
 			Collections::deleteIf(_crafts, 1,
 				[&](Craft* c)
 				{
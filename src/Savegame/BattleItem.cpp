@@ -26,6 +26,7 @@
 #include "../Mod/RuleSkill.h"
 #include "../Mod/RuleInventory.h"
 #include "../Engine/Collections.h"
+#include "../Engine/ObjectPool.h"
 #include "../Engine/Surface.h"
 #include "../Engine/SurfaceSet.h"
 #include "../Engine/Script.h"
@@ -36,6 +37,20 @@
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Gets the pool for all items.
+ */
+ObjectPool<BattleItem> &getBattleItemPool()
+{
+	static ObjectPool<BattleItem> pool;
+	return pool;
+}
+
+}
+
 /**
  * Initializes a item of the specified type.
  * @param rules Pointer to ruleset.
@@ -95,6 +110,40 @@ BattleItem::~BattleItem()
 {
 }
 
+/**
+ * Allocates memory for an item from the pool shared by all items,
+ * so a battle does not scatter thousands of small allocations over the heap.
+ * @param size Size of the object.
+ * @return Memory for the object.
+ */
+void *BattleItem::operator new(std::size_t size)
+{
+	if (size != sizeof(BattleItem))
+	{
+		return ::operator new(size);
+	}
+	return getBattleItemPool().allocate();
+}
+
+/**
+ * Returns memory of an item to the pool.
+ * @param p Memory of the object.
+ * @param size Size of the object.
+ */
+void BattleItem::operator delete(void *p, std::size_t size)
+{
+	if (!p)
+	{
+		return;
+	}
+	if (size != sizeof(BattleItem))
+	{
+		::operator delete(p);
+		return;
+	}
+	getBattleItemPool().deallocate(p);
+}
+
 /**
  * Loads the item from a YAML file.
  * @param node YAML node.
@@ -79,6 +79,10 @@ public:
 	BattleItem(const RuleItem *rules, int *id);
 	/// Cleans up the item.
 	~BattleItem();
+	/// Allocates memory for an item from the item pool.
+	static void *operator new(std::size_t size);
+	/// Returns memory of an item to the item pool.
+	static void operator delete(void *p, std::size_t size);
 	/// Loads the item from YAML.
 	void load(const YAML::Node& node, Mod *mod, const ScriptGlobal *shared);
 	/// Saves the item to YAML.
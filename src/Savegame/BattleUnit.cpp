@@ -21,6 +21,7 @@
 #include <sstream>
 #include <algorithm>
 #include "../Engine/Collections.h"
+#include "../Engine/ObjectPool.h"
 #include "../Engine/Surface.h"
 #include "../Engine/Script.h"
 #include "../Engine/ScriptBind.h"
@@ -55,6 +56,20 @@
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Gets the pool for all units.
+ */
+ObjectPool<BattleUnit> &getBattleUnitPool()
+{
+	static ObjectPool<BattleUnit> pool;
+	return pool;
+}
+
+}
+
 /**
  * Initializes a BattleUnit from a Soldier
  * @param soldier Pointer to the Soldier.
@@ -64,10 +79,10 @@ BattleUnit::BattleUnit(const Mod *mod, Soldier *soldier, int depth, const RuleSt
 	_faction(FACTION_PLAYER), _originalFaction(FACTION_PLAYER), _killedBy(FACTION_PLAYER), _id(0), _tile(0),
 	_lastPos(Position()), _direction(0), _toDirection(0), _directionTurret(0), _toDirectionTurret(0),
 	_verticalDirection(0), _status(STATUS_STANDING), _wantsToSurrender(false), _isSurrendering(false), _walkPhase(0), _fallPhase(0), _kneeled(false), _floating(false),
-	_dontReselect(false), _fire(0), _currentAIState(0), _visible(false),
+	_dontReselect(false), _visible(false), _armor(0), _fire(0), _currentAIState(0),
 	_exp{ }, _expTmp{ },
 	_motionPoints(0), _scannedTurn(-1), _kills(0), _hitByFire(false), _hitByAnything(false), _alreadyExploded(false), _fireMaxHit(0), _smokeMaxHit(0), _moraleRestored(0), _charging(0), _turnsSinceSpotted(255), _turnsLeftSpottedForSnipers(0),
-	_statistics(), _murdererId(0), _mindControllerID(0), _fatalShotSide(SIDE_FRONT), _fatalShotBodyPart(BODYPART_HEAD), _armor(0),
+	_statistics(), _murdererId(0), _mindControllerID(0), _fatalShotSide(SIDE_FRONT), _fatalShotBodyPart(BODYPART_HEAD),
 	_geoscapeSoldier(soldier), _unitRules(0), _rankInt(0), _turretType(-1), _hidingForTurn(false), _floorAbove(false), _respawn(false), _alreadyRespawned(false),
 	_isLeeroyJenkins(false), _summonedPlayerUnit(false), _resummonedFakeCivilian(false), _pickUpWeaponsMoreActively(false), _disableIndicators(false),
 	_capturable(true), _vip(false), _bannedInNextStage(false)
@@ -387,12 +402,12 @@ BattleUnit::BattleUnit(const Mod *mod, Unit *unit, UnitFaction faction, int id,
 	_faction(faction), _originalFaction(faction), _killedBy(faction), _id(id),
 	_tile(0), _lastPos(Position()), _direction(0), _toDirection(0), _directionTurret(0),
 	_toDirectionTurret(0), _verticalDirection(0), _status(STATUS_STANDING), _wantsToSurrender(false), _isSurrendering(false), _walkPhase(0),
-	_fallPhase(0), _kneeled(false), _floating(false), _dontReselect(false), _fire(0), _currentAIState(0),
-	_visible(false), _exp{ }, _expTmp{ },
+	_fallPhase(0), _kneeled(false), _floating(false), _dontReselect(false), _visible(false), _armor(armor),
+	_fire(0), _currentAIState(0), _exp{ }, _expTmp{ },
 	_motionPoints(0), _scannedTurn(-1), _kills(0), _hitByFire(false), _hitByAnything(false), _alreadyExploded(false), _fireMaxHit(0), _smokeMaxHit(0),
 	_moraleRestored(0), _charging(0), _turnsSinceSpotted(255), _turnsLeftSpottedForSnipers(0),
 	_statistics(), _murdererId(0), _mindControllerID(0), _fatalShotSide(SIDE_FRONT),
-	_fatalShotBodyPart(BODYPART_HEAD), _armor(armor), _geoscapeSoldier(0),  _unitRules(unit),
+	_fatalShotBodyPart(BODYPART_HEAD), _geoscapeSoldier(0),  _unitRules(unit),
 	_rankInt(0), _turretType(-1), _hidingForTurn(false), _respawn(false), _alreadyRespawned(false),
 	_isLeeroyJenkins(false), _summonedPlayerUnit(false), _resummonedFakeCivilian(false), _pickUpWeaponsMoreActively(false), _disableIndicators(false),
 	_vip(false), _bannedInNextStage(false)
@@ -571,6 +586,10 @@ void BattleUnit::updateArmorFromNonSoldier(const Mod* mod, Armor* newArmor, int
  */
 BattleUnit::~BattleUnit()
 {
+	if (_hotState)
+	{
+		_hotState->detach(this, _hotHandle);
+	}
 	for (auto* buk : _statistics->kills)
 	{
 		delete buk;
@@ -579,6 +598,39 @@ BattleUnit::~BattleUnit()
 	delete _currentAIState;
 }
 
+/**
+ * Allocates memory for a unit from the pool shared by all units.
+ * @param size Size of the object.
+ * @return Memory for the object.
+ */
+void *BattleUnit::operator new(std::size_t size)
+{
+	if (size != sizeof(BattleUnit))
+	{
+		return ::operator new(size);
+	}
+	return getBattleUnitPool().allocate();
+}
+
+/**
+ * Returns memory of a unit to the pool.
+ * @param p Memory of the object.
+ * @param size Size of the object.
+ */
+void BattleUnit::operator delete(void *p, std::size_t size)
+{
+	if (!p)
+	{
+		return;
+	}
+	if (size != sizeof(BattleUnit))
+	{
+		::operator delete(p);
+		return;
+	}
+	getBattleUnitPool().deallocate(p);
+}
+
 /**
  * Loads the unit from a YAML file.
  * @param node YAML node.
@@ -914,6 +966,7 @@ void BattleUnit::setPosition(Position pos, bool updateLastPos)
 {
 	if (updateLastPos) { _lastPos = _pos; }
 	_pos = pos;
+	updateHotState();
 }
 
 /**
@@ -1132,6 +1185,7 @@ void BattleUnit::keepWalking(SavedBattleGame *savedBattleGame, bool fullWalkCycl
 	if (!fullWalkCycle)
 	{
 		_pos = _destination;
+		updateHotState();
 		end = 2;
 	}
 
@@ -1142,6 +1196,7 @@ void BattleUnit::keepWalking(SavedBattleGame *savedBattleGame, bool fullWalkCycl
 		// we assume we reached our destination tile
 		// this is actually a drawing hack, so soldiers are not overlapped by floor tiles
 		_pos = _destination;
+		updateHotState();
 	}
 
 	if (!fullWalkCycle || (_walkPhase == middle))
@@ -2692,6 +2747,7 @@ void BattleUnit::prepareNewTurn(bool fullProcess)
 	if (_faction != _originalFaction)
 	{
 		_faction = _originalFaction;
+		updateHotState();
 		if (_faction == FACTION_PLAYER && _currentAIState)
 		{
 			delete _currentAIState;
@@ -3141,6 +3197,7 @@ AIModule *BattleUnit::getAIModule() const
 void BattleUnit::setVisible(bool flag)
 {
 	_visible = flag;
+	updateHotState();
 }
 
 
@@ -3231,6 +3288,7 @@ void BattleUnit::setTile(Tile *tile, SavedBattleGame *saveBattleGame)
 	}
 
 	_tile = tile;
+	updateHotState();
 
 	updateTileFloorState(saveBattleGame);
 
@@ -3280,6 +3338,7 @@ void BattleUnit::setTile(Tile *tile, SavedBattleGame *saveBattleGame)
 void BattleUnit::setInventoryTile(Tile *tile)
 {
 	_tile = tile;
+	updateHotState();
 }
 
 /**
@@ -4437,6 +4496,7 @@ const std::string& BattleUnit::getType() const
 void BattleUnit::convertToFaction(UnitFaction f)
 {
 	_faction = f;
+	updateHotState();
 }
 
 /**
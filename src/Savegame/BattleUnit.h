@@ -21,6 +21,7 @@
 #include <string>
 #include <unordered_set>
 #include "../Battlescape/Position.h"
+#include "BattleUnitHotState.h"
 #include "../Mod/Armor.h"
 #include "../Mod/RuleItem.h"
 #include "Soldier.h"
@@ -89,19 +90,23 @@ private:
 	UnitStatus _status;
 	bool _wantsToSurrender, _isSurrendering;
 	int _walkPhase, _fallPhase;
-	std::vector<BattleUnit *> _visibleUnits, _unitsSpottedThisTurn;
-	std::vector<Tile *> _visibleTiles;
-	std::unordered_set<Tile *> _visibleTilesLookup;
 	int _tu, _energy, _health, _morale, _stunlevel, _mana;
 	bool _kneeled, _floating, _dontReselect;
 	bool _haveNoFloorBelow = false;
+	bool _visible;
+	Armor *_armor;
+	// everything above is read by most scans over all units, keep it together at the start of the object
+	BattleUnitHotState *_hotState = nullptr;
+	BattleUnitHandle _hotHandle;
+	std::vector<BattleUnit *> _visibleUnits, _unitsSpottedThisTurn;
+	std::vector<Tile *> _visibleTiles;
+	std::unordered_set<Tile *> _visibleTilesLookup;
 	int _currentArmor[SIDE_MAX], _maxArmor[SIDE_MAX];
 	int _fatalWounds[BODYPART_MAX];
 	int _fire;
 	std::vector<BattleItem*> _inventory;
 	BattleItem* _specWeapon[SPEC_WEAPON_MAX];
 	AIModule *_currentAIState;
-	bool _visible;
 	UnitStats _exp, _expTmp;
 	int _motionPoints;
 	int _scannedTurn;
@@ -140,7 +145,6 @@ private:
 	int _maxViewDistanceAtDark, _maxViewDistanceAtDay;
 	int _maxViewDistanceAtDarkSquared;
 	SpecialAbility _specab;
-	Armor *_armor;
 	SoldierGender _gender;
 	Soldier *_geoscapeSoldier;
 	std::vector<int> _loftempsSet;
@@ -190,6 +194,8 @@ private:
 	void prepareBannedFlag(const RuleStartingCondition* sc);
 	/// Applies percentual and/or flat adjustments to the use costs.
 	void applyPercentages(RuleItemUseCost &cost, const RuleItemUseCost &flat) const;
+	/// Writes changed fields through to the battle's unit arrays.
+	void updateHotState() { if (_hotState) _hotState->update(this, _hotHandle); }
 public:
 	static const int MAX_SOLDIER_ID = 1000000;
 	static const int BUBBLES_FIRST_FRAME = 3;
@@ -212,6 +218,10 @@ public:
 	void updateArmorFromNonSoldier(const Mod* mod, Armor* newArmor, int depth, bool nextStage, const RuleStartingCondition* sc);
 	/// Cleans up the BattleUnit.
 	~BattleUnit();
+	/// Allocates memory for a unit from the unit pool.
+	static void *operator new(std::size_t size);
+	/// Returns memory of a unit to the unit pool.
+	static void operator delete(void *p, std::size_t size);
 	/// Loads the unit from YAML.
 	void load(const YAML::Node &node, const Mod *mod, const ScriptGlobal *shared);
 	/// Saves the unit to YAML.
@@ -224,6 +234,10 @@ public:
 	int distance3dToUnitSq(BattleUnit* otherUnit) const;
 	/// Sets the unit's position
 	void setPosition(Position pos, bool updateLastPos = true);
+	/// Sets the battle's unit arrays this unit writes its changes to.
+	void setHotState(BattleUnitHotState *hotState, BattleUnitHandle handle) { _hotState = hotState; _hotHandle = handle; }
+	/// Gets the handle of this unit in the battle's unit arrays.
+	BattleUnitHandle getHotHandle() const { return _hotHandle; }
 	/// Gets the unit's position.
 	Position getPosition() const;
 	/// Gets the unit's position.
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "BattleUnitHotState.h"
+#include "BattleUnit.h"
+
+namespace OpenXcom
+{
+
+/**
+ * Detaches all units still attached, so none of them
+ * writes to the arrays after they are gone.
+ */
+BattleUnitHotState::~BattleUnitHotState()
+{
+	clear();
+}
+
+/**
+ * Copies the fields of a unit into a slot.
+ * @param unit Unit.
+ * @param index Slot of the unit.
+ */
+void BattleUnitHotState::copy(const BattleUnit *unit, int index)
+{
+	_positions[index] = unit->getPosition();
+	_factions[index] = unit->getFaction();
+	_tiles[index] = unit->getTile();
+	_visible[index] = unit->getVisible();
+}
+
+/**
+ * Matches the arrays up with the list of units.
+ * Only the unit pointers are compared, so this is cheap when
+ * nothing changed. Units that moved to a different slot
+ * or were added get attached and copied again.
+ * @param units Units of the battle.
+ */
+void BattleUnitHotState::sync(const std::vector<BattleUnit*> &units)
+{
+	const int count = (int)units.size();
+	if ((int)_units.size() != count)
+	{
+		_units.resize(count, nullptr);
+		_positions.resize(count);
+		_factions.resize(count);
+		_tiles.resize(count);
+		_visible.resize(count);
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		if (_units[i] != units[i])
+		{
+			_units[i] = units[i];
+			units[i]->setHotState(this, BattleUnitHandle{ i });
+			copy(units[i], i);
+		}
+	}
+}
+
+/**
+ * Detaches all units and empties the arrays.
+ */
+void BattleUnitHotState::clear()
+{
+	for (int i = 0; i < (int)_units.size(); ++i)
+	{
+		if (_units[i])
+		{
+			_units[i]->setHotState(nullptr, BattleUnitHandle{ });
+		}
+	}
+	_units.clear();
+	_positions.clear();
+	_factions.clear();
+	_tiles.clear();
+	_visible.clear();
+}
+
+/**
+ * Updates the slot of a unit after one of its fields changes.
+ * A unit that lost its slot to another one (e.g. was removed from the
+ * battle) doesn't write anything, sync() attaches it again if needed.
+ * @param unit Unit.
+ * @param handle Handle of the unit.
+ */
+void BattleUnitHotState::update(const BattleUnit *unit, BattleUnitHandle handle)
+{
+	if (handle.index < (int)_units.size() && _units[handle.index] == unit)
+	{
+		copy(unit, handle.index);
+	}
+}
+
+/**
+ * Drops a unit that is being deleted, so a new unit
+ * created at the same address is attached by sync().
+ * @param unit Unit.
+ * @param handle Handle of the unit.
+ */
+void BattleUnitHotState::detach(const BattleUnit *unit, BattleUnitHandle handle)
+{
+	if (handle.index < (int)_units.size() && _units[handle.index] == unit)
+	{
+		_units[handle.index] = nullptr;
+	}
+}
+
+}
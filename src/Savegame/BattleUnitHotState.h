@@ -0,0 +1,93 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <vector>
+#include "../Battlescape/Position.h"
+
+namespace OpenXcom
+{
+
+enum UnitFaction : int;
+class BattleUnit;
+class Tile;
+
+/**
+ * Handle of a unit in BattleUnitHotState.
+ */
+struct BattleUnitHandle
+{
+	int index = -1;
+
+	/// Is this handle pointing to any unit?
+	bool isValid() const { return index >= 0; }
+};
+
+/**
+ * Copies of the unit fields read by most scans over all units
+ * in a battle, kept in parallel arrays in the same order as
+ * SavedBattleGame::getUnits(). Scans can stream through these
+ * instead of visiting every unit object.
+ * Units write their changes through using their handle,
+ * the order of units is matched up again by sync() before a scan.
+ */
+class BattleUnitHotState
+{
+private:
+	std::vector<BattleUnit*> _units;
+	std::vector<Position> _positions;
+	std::vector<UnitFaction> _factions;
+	std::vector<Tile*> _tiles;
+	std::vector<char> _visible;
+
+	/// Copies the fields of a unit into its slot.
+	void copy(const BattleUnit *unit, int index);
+public:
+	/// Creates empty arrays.
+	BattleUnitHotState() = default;
+	/// Detaches all units still attached.
+	~BattleUnitHotState();
+	/// Not copyable, units point to it.
+	BattleUnitHotState(const BattleUnitHotState&) = delete;
+	/// Not copyable, units point to it.
+	BattleUnitHotState& operator=(const BattleUnitHotState&) = delete;
+
+	/// Matches the arrays up with the list of units.
+	void sync(const std::vector<BattleUnit*> &units);
+	/// Detaches all units.
+	void clear();
+	/// Updates the slot of a unit after its fields change.
+	void update(const BattleUnit *unit, BattleUnitHandle handle);
+	/// Drops a unit that is being deleted.
+	void detach(const BattleUnit *unit, BattleUnitHandle handle);
+
+	/// Gets the number of units.
+	int size() const { return (int)_units.size(); }
+	/// Gets the unit of a handle.
+	BattleUnit *getUnit(BattleUnitHandle handle) const { return _units[handle.index]; }
+	/// Gets the position of a unit.
+	Position getPosition(BattleUnitHandle handle) const { return _positions[handle.index]; }
+	/// Gets the faction of a unit.
+	UnitFaction getFaction(BattleUnitHandle handle) const { return _factions[handle.index]; }
+	/// Gets the tile of a unit.
+	Tile *getTile(BattleUnitHandle handle) const { return _tiles[handle.index]; }
+	/// Gets whether a unit is visible.
+	bool getVisible(BattleUnitHandle handle) const { return _visible[handle.index]; }
+};
+
+}
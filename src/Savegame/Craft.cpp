@@ -88,7 +88,7 @@ namespace OpenXcom
 Craft::Craft(const RuleCraft *rules, Base *base, int id) : MovingTarget(),
 	_rules(rules), _base(base), _fuel(0), _damage(0), _shield(0),
 	_interceptionOrder(0), _takeoff(0), _weapons(),
-	_status("STR_READY"), _lowFuel(false), _mission(false),
+	_status(CRAFT_READY), _lowFuel(false), _mission(false),
 	_inBattlescape(false), _inDogfight(false), _stats(),
 	_isAutoPatrolling(false), _lonAuto(0.0), _latAuto(0.0),
 	_skinIndex(0)
@@ -179,22 +179,18 @@ void Craft::load(const YAML::Node &node, const ScriptGlobal *shared, const Mod *
 
 	_items->load(node["items"]);
 	// Some old saves have bad items, better get rid of them to avoid further bugs
-	for (auto iter = _items->getContents()->begin(); iter != _items->getContents()->end();)
+	for (const auto& entry : *_items)
 	{
-		auto* ruleItem = mod->getItem(iter->first);
+		auto* ruleItem = mod->getItemByTypeIndex(entry.index);
 		if (!ruleItem)
 		{
-			Log(LOG_ERROR) << "Failed to load item " << iter->first;
-			_items->getContents()->erase(iter++);
+			Log(LOG_ERROR) << "Failed to load item " << entry.type;
+			_items->removeItem(entry.type, entry.qty);
 		}
 		else if (!ruleItem->canBeEquippedToCraftInventory())
 		{
-			Log(LOG_WARNING) << "Item '" << iter->first << "' cannot be equipped in the craft inventory (" << _rules->getType() << ", " << _id << "). Skipping " << iter->second << " items.";
-			_items->getContents()->erase(iter++);
-		}
-		else
-		{
-			++iter;
+			Log(LOG_WARNING) << "Item '" << entry.type << "' cannot be equipped in the craft inventory (" << _rules->getType() << ", " << _id << "). Skipping " << entry.qty << " items.";
+			_items->removeItem(ruleItem, entry.qty);
 		}
 	}
 	for (YAML::const_iterator i = node["vehicles"].begin(); i != node["vehicles"].end(); ++i)
@@ -221,7 +217,10 @@ void Craft::load(const YAML::Node &node, const ScriptGlobal *shared, const Mod *
 			Log(LOG_ERROR) << "Failed to load vehicles item " << type;
 		}
 	}
-	_status = node["status"].as<std::string>(_status);
+	if (const YAML::Node &status = node["status"])
+	{
+		_status = getStatusFromString(status.as<std::string>());
+	}
 	_lowFuel = node["lowFuel"].as<bool>(_lowFuel);
 	_mission = node["mission"].as<bool>(_mission);
 	_interceptionOrder = node["interceptionOrder"].as<int>(_interceptionOrder);
@@ -383,7 +382,7 @@ YAML::Node Craft::save(const ScriptGlobal *shared) const
 	{
 		node["vehicles"].push_back(vehicle->save());
 	}
-	node["status"] = _status;
+	node["status"] = getStatusString();
 	if (_lowFuel)
 		node["lowFuel"] = _lowFuel;
 	if (_mission)
@@ -479,7 +478,7 @@ std::string Craft::getDefaultName(Language *lang) const
  */
 int Craft::getMarker() const
 {
-	if (_status != "STR_OUT")
+	if (_status != CRAFT_OUT)
 		return -1;
 	else if (_rules->getMarker() == -1)
 		return 1;
@@ -511,21 +510,43 @@ void Craft::setBase(Base *base, bool move)
 }
 
 /**
- * Returns the current status of the craft.
+ * Changes the current status of the craft.
+ * @param status Status.
+ */
+void Craft::setStatus(CraftStatus status)
+{
+	_status = status;
+}
+
+/**
+ * Returns the current status of the craft as used
+ * in saves and translations.
  * @return Status string.
  */
-std::string Craft::getStatus() const
+const std::string &Craft::getStatusString() const
 {
-	return _status;
+	static const std::string names[] = { "STR_READY", "STR_OUT", "STR_REPAIRS", "STR_REFUELLING", "STR_REARMING" };
+	return names[_status];
 }
 
 /**
- * Changes the current status of the craft.
+ * Converts a saved status string to a craft status.
  * @param status Status string.
+ * @return Status, ready for unknown strings.
  */
-void Craft::setStatus(const std::string &status)
+CraftStatus Craft::getStatusFromString(const std::string &status)
 {
-	_status = status;
+	if (status == "STR_OUT")
+		return CRAFT_OUT;
+	if (status == "STR_REPAIRS")
+		return CRAFT_REPAIRS;
+	if (status == "STR_REFUELLING")
+		return CRAFT_REFUELLING;
+	if (status == "STR_REARMING")
+		return CRAFT_REARMING;
+	if (status != "STR_READY")
+		Log(LOG_WARNING) << "Unknown craft status " << status << ", craft set to ready";
+	return CRAFT_READY;
 }
 
 /**
@@ -552,7 +573,7 @@ std::string Craft::getAltitude() const
  */
 void Craft::setDestination(Target *dest)
 {
-	if (_status != "STR_OUT")
+	if (_status != CRAFT_OUT)
 	{
 		_takeoff = 60;
 	}
@@ -684,7 +705,7 @@ std::vector<Vehicle*> *Craft::getVehicles()
  */
 void Craft::calculateTotalSoldierEquipment()
 {
-	_tempSoldierItems->getContents()->clear();
+	_tempSoldierItems->clear();
 
 	for (auto* soldier : *_base->getSoldiers())
 	{
@@ -1156,19 +1177,19 @@ void Craft::checkup()
 
 	if (_damage > 0)
 	{
-		_status = "STR_REPAIRS";
+		_status = CRAFT_REPAIRS;
 	}
 	else if (available != full)
 	{
-		_status = "STR_REARMING";
+		_status = CRAFT_REARMING;
 	}
 	else if (_fuel < _stats.fuelMax)
 	{
-		_status = "STR_REFUELLING";
+		_status = CRAFT_REFUELLING;
 	}
 	else
 	{
-		_status = "STR_READY";
+		_status = CRAFT_READY;
 	}
 }
 
@@ -1288,7 +1309,7 @@ void Craft::repair()
 	setDamage(_damage - _rules->getRepairRate());
 	if (_damage <= 0)
 	{
-		_status = "STR_REARMING";
+		_status = CRAFT_REARMING;
 	}
 }
 
@@ -1320,7 +1341,7 @@ std::string Craft::refuel()
 				fuel = item;
 				if (_fuel > 0)
 				{
-					_status = "STR_READY";
+					_status = CRAFT_READY;
 				}
 				else
 				{
@@ -1331,12 +1352,12 @@ std::string Craft::refuel()
 	}
 	if (_fuel >= _stats.fuelMax)
 	{
-		_status = "STR_READY";
+		_status = CRAFT_READY;
 		for (const auto* cw : _weapons)
 		{
 			if (cw && cw->isRearming())
 			{
-				_status = "STR_REARMING";
+				_status = CRAFT_REARMING;
 				break;
 			}
 		}
@@ -1357,7 +1378,7 @@ const RuleItem* Craft::rearm()
 	{
 		if (iter == _weapons.end())
 		{
-			_status = "STR_REFUELLING";
+			_status = CRAFT_REFUELLING;
 			break;
 		}
 		CraftWeapon* cw = (*iter);
@@ -1795,9 +1816,9 @@ void Craft::unload()
 	}
 
 	// Remove items
-	for (const auto& pair : *_items->getContents())
+	for (const auto& entry : *_items)
 	{
-		_base->getStorageItems()->addItem(pair.first, pair.second);
+		_base->getStorageItems()->addItem(entry.type, entry.qty);
 	}
 
 	// Remove vehicles
@@ -1835,7 +1856,7 @@ void Craft::reuseItem(const RuleItem* item)
 	// (And we don't want to interrupt any out-of-base status.)
 
 	// The only states we are willing to interrupt are "ready" and "refuelling"
-	if (_status != "STR_READY" && _status != "STR_REFUELLING")
+	if (_status != CRAFT_READY && _status != CRAFT_REFUELLING)
 	{
 		return;
 	}
@@ -1846,17 +1867,17 @@ void Craft::reuseItem(const RuleItem* item)
 		if (cw != 0 && item == cw->getRules()->getClipItem() && cw->getAmmo() < cw->getRules()->getAmmoMax() && !cw->isDisabled())
 		{
 			cw->setRearming(true);
-			_status = "STR_REARMING";
+			_status = CRAFT_REARMING;
 		}
 	}
 
 	// Only consider refuelling if everything else is complete
-	if (_status != "STR_READY")
+	if (_status != CRAFT_READY)
 		return;
 
 	// Check if it's fuel to refuel the craft
 	if (item->getType() == _rules->getRefuelItem() && _fuel < _stats.fuelMax)
-		_status = "STR_REFUELLING";
+		_status = CRAFT_REFUELLING;
 }
 
 /**
@@ -45,6 +45,7 @@ class ScriptParserBase;
 class ScriptGlobal;
 
 enum UfoDetection : int;
+enum CraftStatus : char { CRAFT_READY, CRAFT_OUT, CRAFT_REPAIRS, CRAFT_REFUELLING, CRAFT_REARMING };
 
 typedef std::pair<Position, int> SoldierDeploymentData;
 
@@ -81,7 +82,7 @@ private:
 	ItemContainer *_tempSoldierItems;
 	ItemContainer *_tempExtraItems;
 	std::vector<Vehicle*> _vehicles;
-	std::string _status;
+	CraftStatus _status;
 	bool _lowFuel, _mission, _inBattlescape, _inDogfight;
 	double _speedMaxRadian;
 	RuleCraftStats _stats;
@@ -128,9 +129,13 @@ public:
 	/// Sets the craft's base.
 	void setBase(Base *base, bool move = true);
 	/// Gets the craft's status.
-	std::string getStatus() const;
+	CraftStatus getStatus() const { return _status; }
 	/// Sets the craft's status.
-	void setStatus(const std::string &status);
+	void setStatus(CraftStatus status);
+	/// Gets the craft's status string.
+	const std::string &getStatusString() const;
+	/// Gets the status for a status string.
+	static CraftStatus getStatusFromString(const std::string &status);
 	/// Gets the craft's altitude.
 	std::string getAltitude() const;
 	/// Sets the craft's destination.
@@ -19,6 +19,8 @@
 #include "ItemContainer.h"
 #include "../Mod/Mod.h"
 #include "../Mod/RuleItem.h"
+#include <climits>
+#include <algorithm>
 
 namespace OpenXcom
 {
@@ -37,13 +39,34 @@ ItemContainer::~ItemContainer()
 {
 }
 
+/**
+ * Gets the type index of an item name.
+ * Names unknown to the current mod still get an index,
+ * so items from removed mods are preserved like before.
+ * @param id Item ID.
+ * @return Item type index.
+ */
+int ItemContainer::getTypeIndex(const std::string &id)
+{
+	auto& table = RuleItem::getTypeIndexTable();
+	int index = (int)table.getIndex(id);
+	if (index == 0)
+	{
+		index = (int)table.addName(id, INT_MAX);
+	}
+	return index;
+}
+
 /**
  * Loads the item container from a YAML file.
  * @param node YAML node.
  */
 void ItemContainer::load(const YAML::Node &node)
 {
-	_qty = node.as< std::map<std::string, int> >(_qty);
+	for (const auto& pair : node)
+	{
+		addItem(pair.first.as<std::string>(), pair.second.as<int>());
+	}
 }
 
 /**
@@ -53,7 +76,10 @@ void ItemContainer::load(const YAML::Node &node)
 YAML::Node ItemContainer::save() const
 {
 	YAML::Node node;
-	node = _qty;
+	for (const auto& entry : getSortedEntries())
+	{
+		node.force_insert(entry.type, entry.qty);
+	}
 	return node;
 }
 
@@ -68,7 +94,13 @@ void ItemContainer::addItem(const std::string &id, int qty)
 	{
 		return;
 	}
-	_qty[id] += qty;
+	int index = getTypeIndex(id);
+	if (index >= (int)_qty.size())
+	{
+		_qty.resize(index + 1, 0);
+	}
+	_qty[index] += qty;
+	invalidateTotalSize();
 }
 
 /**
@@ -80,7 +112,13 @@ void ItemContainer::addItem(const RuleItem* item, int qty)
 {
 	if (item)
 	{
-		addItem(item->getType(), qty);
+		int index = item->getTypeIndex();
+		if (index >= (int)_qty.size())
+		{
+			_qty.resize(index + 1, 0);
+		}
+		_qty[index] += qty;
+		invalidateTotalSize();
 	}
 }
 
@@ -95,20 +133,21 @@ void ItemContainer::removeItem(const std::string &id, int qty)
 	{
 		return;
 	}
-	auto it = _qty.find(id);
-	if (it == _qty.end())
+	int index = (int)RuleItem::getTypeIndexTable().getIndex(id);
+	if (index == 0 || index >= (int)_qty.size())
 	{
 		return;
 	}
 
-	if (qty < it->second)
+	if (qty < _qty[index])
 	{
-		it->second -= qty;
+		_qty[index] -= qty;
 	}
 	else
 	{
-		_qty.erase(it);
+		_qty[index] = 0;
 	}
+	invalidateTotalSize();
 }
 
 /**
@@ -120,7 +159,21 @@ void ItemContainer::removeItem(const RuleItem* item, int qty)
 {
 	if (item)
 	{
-		removeItem(item->getType(), qty);
+		int index = item->getTypeIndex();
+		if (index >= (int)_qty.size())
+		{
+			return;
+		}
+
+		if (qty < _qty[index])
+		{
+			_qty[index] -= qty;
+		}
+		else
+		{
+			_qty[index] = 0;
+		}
+		invalidateTotalSize();
 	}
 }
 
@@ -136,14 +189,14 @@ int ItemContainer::getItem(const std::string &id) const
 		return 0;
 	}
 
-	auto it = _qty.find(id);
-	if (it == _qty.end())
+	int index = (int)RuleItem::getTypeIndexTable().getIndex(id);
+	if (index >= (int)_qty.size())
 	{
 		return 0;
 	}
 	else
 	{
-		return it->second;
+		return _qty[index];
 	}
 }
 
@@ -154,9 +207,9 @@ int ItemContainer::getItem(const std::string &id) const
  */
 int ItemContainer::getItem(const RuleItem* item) const
 {
-	if (item)
+	if (item && item->getTypeIndex() < (int)_qty.size())
 	{
-		return getItem(item->getType());
+		return _qty[item->getTypeIndex()];
 	}
 	else
 	{
@@ -171,35 +224,86 @@ int ItemContainer::getItem(const RuleItem* item) const
 int ItemContainer::getTotalQuantity() const
 {
 	int total = 0;
-	for (const auto& pair : _qty)
+	for (int qty : _qty)
 	{
-		total += pair.second;
+		total += qty;
 	}
 	return total;
 }
 
 /**
  * Returns the total size of the items in the container.
+ * The sum is kept until the contents change, as the store screens
+ * ask for it after every click.
  * @param mod Pointer to mod.
  * @return Total item size.
  */
 double ItemContainer::getTotalSize(const Mod *mod) const
 {
-	double total = 0;
-	for (const auto& pair : _qty)
+	// keyed on the generation, a reloaded mod can end up at the same address
+	if (_totalSizeModGeneration != mod->getGeneration())
 	{
-		total += mod->getItem(pair.first, true)->getSize() * pair.second;
+		double total = 0;
+		for (const auto& entry : *this)
+		{
+			total += mod->getItemByTypeIndex(entry.index, true)->getSize() * entry.qty;
+		}
+		_totalSize = total;
+		_totalSizeModGeneration = mod->getGeneration();
 	}
-	return total;
+	return _totalSize;
+}
+
+/**
+ * Returns the non-empty entries of the container sorted by item name.
+ * Iterating the container goes by type index instead, which depends on
+ * the loaded mods, so anything where the order shows (saves, items placed
+ * in battle) should use this.
+ * @return Entries in alphabetical order.
+ */
+std::vector<ItemContainer::Entry> ItemContainer::getSortedEntries() const
+{
+	std::vector<int> indexes;
+	for (const auto& entry : *this)
+	{
+		indexes.push_back(entry.index);
+	}
+	auto& table = RuleItem::getTypeIndexTable();
+	std::sort(indexes.begin(), indexes.end(), [&](int a, int b) { return table.getName(a) < table.getName(b); });
+	std::vector<Entry> entries;
+	entries.reserve(indexes.size());
+	for (int index : indexes)
+	{
+		entries.push_back(Entry{ table.getName(index), index, _qty[index] });
+	}
+	return entries;
+}
+
+/**
+ * Checks if the container has no items.
+ * @return True when all quantities are zero.
+ */
+bool ItemContainer::empty() const
+{
+	return !(begin() != end());
+}
+
+/**
+ * Removes all items from the container.
+ */
+void ItemContainer::clear()
+{
+	_qty.clear();
+	invalidateTotalSize();
 }
 
 /**
- * Returns all the items currently contained within.
- * @return List of contents.
+ * Gets the entry the iterator points to.
+ * @return Item type, type index and quantity.
  */
-std::map<std::string, int> *ItemContainer::getContents()
+ItemContainer::Entry ItemContainer::Iterator::operator*() const
 {
-	return &_qty;
+	return Entry{ RuleItem::getTypeIndexTable().getName(_index), _index, _container->_qty[_index] };
 }
 
 }
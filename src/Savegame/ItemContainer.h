@@ -18,7 +18,7 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <string>
-#include <map>
+#include <vector>
 #include <yaml-cpp/yaml.h>
 
 namespace OpenXcom
@@ -31,11 +31,74 @@ class RuleItem;
  * Represents the items contained by a certain entity,
  * like base stores, craft equipment, etc.
  * Handles all necessary item management tasks.
+ * Quantities are stored in a flat array indexed by
+ * item type index (see RuleItem::getTypeIndex).
  */
 class ItemContainer
 {
+public:
+	/**
+	 * Single non-empty entry of the container.
+	 */
+	struct Entry
+	{
+		/// Item type.
+		const std::string &type;
+		/// Item type index.
+		int index;
+		/// Item quantity.
+		int qty;
+	};
+
+	/**
+	 * Iterator over non-empty entries of the container.
+	 * Removing items while iterating is safe.
+	 */
+	class Iterator
+	{
+		const ItemContainer *_container;
+		int _index;
+
+	public:
+		/// Creates iterator pointing to first non-empty entry at or after index.
+		Iterator(const ItemContainer *container, int index) : _container{ container }, _index{ index }
+		{
+			skipEmpty();
+		}
+
+		Entry operator*() const;
+
+		void operator++()
+		{
+			++_index;
+			skipEmpty();
+		}
+
+		bool operator!=(const Iterator& r) const
+		{
+			return _index != r._index;
+		}
+
+	private:
+		void skipEmpty()
+		{
+			while (_index < (int)_container->_qty.size() && _container->_qty[_index] == 0)
+			{
+				++_index;
+			}
+		}
+	};
+
 private:
-	std::map<std::string, int> _qty;
+	std::vector<int> _qty;
+	/// Total size of the items, valid only for the mod generation in _totalSizeModGeneration.
+	mutable double _totalSize = 0.0;
+	mutable int _totalSizeModGeneration = 0;
+
+	/// Gets the type index for an item name, adding unknown names to the table.
+	static int getTypeIndex(const std::string &id);
+	/// Marks the cached total size as outdated.
+	void invalidateTotalSize() { _totalSizeModGeneration = 0; }
 public:
 	/// Creates an empty item container.
 	ItemContainer();
@@ -61,8 +124,18 @@ public:
 	int getTotalQuantity() const;
 	/// Gets the total size of items in the container.
 	double getTotalSize(const Mod *mod) const;
-	/// Gets all the items in the container.
-	std::map<std::string, int> *getContents();
+	/// Checks if the container has no items.
+	bool empty() const;
+	/// Removes all items from the container.
+	void clear();
+
+	/// Gets the non-empty entries sorted by item name.
+	std::vector<Entry> getSortedEntries() const;
+
+	/// Gets iterator to the first non-empty entry.
+	Iterator begin() const { return Iterator{ this, 0 }; }
+	/// Gets iterator past the last entry.
+	Iterator end() const { return Iterator{ this, (int)_qty.size() }; }
 };
 
 }
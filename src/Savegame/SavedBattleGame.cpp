@@ -733,6 +733,7 @@ void SavedBattleGame::initMap(int mapsize_x, int mapsize_y, int mapsize_z, bool
 
 	_tiles.clear();
 	_tiles.reserve(_mapsize_z * _mapsize_y * _mapsize_x);
+	_tileMapData.assign(_mapsize_z * _mapsize_y * _mapsize_x, Tile::TileMapDataCache{});
 	for (int i = 0; i < _mapsize_z * _mapsize_y * _mapsize_x; ++i)
 	{
 		_tiles.push_back(Tile(getTileCoords(i), this));
@@ -1096,6 +1097,17 @@ std::vector<BattleUnit*> *SavedBattleGame::getUnits()
 	return &_units;
 }
 
+/**
+ * Gets the unit fields read by scans over all units,
+ * matched up with the current list of units first.
+ * @return Unit arrays, indexed like the list of units.
+ */
+const BattleUnitHotState &SavedBattleGame::getUnitHotState()
+{
+	_unitHotState.sync(_units);
+	return _unitHotState;
+}
+
 /**
  * Gets the list of items.
  * @return Pointer to the list of items.
@@ -2675,11 +2687,13 @@ bool SavedBattleGame::setUnitPosition(BattleUnit *bu, Position position, bool te
  */
 bool SavedBattleGame::eyesOnTarget(UnitFaction faction, BattleUnit* unit)
 {
-	for (auto* bu : *getUnits())
+	const auto& hot = getUnitHotState();
+	for (int i = 0; i < hot.size(); ++i)
 	{
-		if (bu->getFaction() != faction) continue;
+		BattleUnitHandle h{ i };
+		if (hot.getFaction(h) != faction) continue;
 
-		auto* vis = bu->getVisibleUnits();
+		auto* vis = hot.getUnit(h)->getVisibleUnits();
 		if (std::find(vis->begin(), vis->end(), unit) != vis->end()) return true;
 		// aliens know the location of all XCom agents sighted by all other aliens due to sharing locations over their space-walkie-talkies
 	}
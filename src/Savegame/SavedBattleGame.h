@@ -21,6 +21,7 @@
 #include <string>
 #include <yaml-cpp/yaml.h>
 #include "Tile.h"
+#include "BattleUnitHotState.h"
 #include "../Mod/AlienDeployment.h"
 #include "../Mod/RuleCraft.h"
 
@@ -73,9 +74,11 @@ private:
 	int _mapsize_x, _mapsize_y, _mapsize_z;
 	std::vector<MapDataSet*> _mapDataSets;
 	std::vector<Tile> _tiles;
+	std::vector<Tile::TileMapDataCache> _tileMapData;
 	BattleUnit *_selectedUnit, *_lastSelectedUnit;
 	std::vector<Node*> _nodes;
 	std::vector<BattleUnit*> _units;
+	BattleUnitHotState _unitHotState;
 	std::vector<BattleItem*> _items, _deleted;
 	Pathfinding *_pathfinding;
 	TileEngine *_tileEngine;
@@ -218,6 +221,8 @@ public:
 	std::vector<BattleItem*> *getItems();
 	/// Gets a pointer to the list of units.
 	std::vector<BattleUnit*> *getUnits();
+	/// Gets the unit fields read by scans over all units, in the same order as the units.
+	const BattleUnitHotState &getUnitHotState();
 	/// Gets terrain size x.
 	int getMapSizeX() const { return _mapsize_x; }
 	/// Gets terrain size y.
@@ -298,6 +303,11 @@ public:
 		return &_tiles[i];
 	}
 
+	/// Gets the map data IDs of the tile at the given index.
+	Tile::TileMapDataCache &getTileMapDataCache(int i) { return _tileMapData[i]; }
+	/// Gets the map data IDs of the tile at the given index.
+	const Tile::TileMapDataCache &getTileMapDataCache(int i) const { return _tileMapData[i]; }
+
 	/**
 	 * Get tile that is below current one (const version).
 	 * @param tile
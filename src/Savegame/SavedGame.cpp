@@ -73,30 +73,12 @@ namespace OpenXcom
 
 const std::string SavedGame::AUTOSAVE_GEOSCAPE = "_autogeo_.asav",
 				  SavedGame::AUTOSAVE_BATTLESCAPE = "_autobattle_.asav",
-				  SavedGame::QUICKSAVE = "_quick_.asav";
+				  SavedGame::QUICKSAVE = "_quick_.asav",
+				  SavedGame::SAVE_INDEX = "_saveindex_.yml";
 
 namespace
 {
 
-struct findRuleResearch
-{
-	typedef ResearchProject* argument_type;
-	typedef bool result_type;
-
-	RuleResearch * _toFind;
-	findRuleResearch(RuleResearch * toFind);
-	bool operator()(const ResearchProject *r) const;
-};
-
-findRuleResearch::findRuleResearch(RuleResearch * toFind) : _toFind(toFind)
-{
-}
-
-bool findRuleResearch::operator()(const ResearchProject *r) const
-{
-	return _toFind == r->getRules();
-}
-
 struct equalProduction
 {
 	typedef Production* argument_type;
@@ -139,6 +121,97 @@ bool haveReserchVector(const std::vector<const RuleResearch*> &vec,  const std::
 	return find != vec.end();
 }
 
+/**
+ * Inserts a topic into a sorted vector, keeping it sorted.
+ * @return False if the topic was already there.
+ */
+bool addReserchVector(std::vector<const RuleResearch*> &vec, const RuleResearch *res)
+{
+	auto find = std::lower_bound(vec.begin(), vec.end(), res, researchLess);
+	if (find != vec.end() && *find == res)
+	{
+		return false;
+	}
+	vec.insert(find, res);
+	return true;
+}
+
+/**
+ * Target of the full game data in a save: either an emitter with a map
+ * currently open, streamed to right away, or a map node collecting
+ * a snapshot to be emitted later.
+ */
+class SaveWriter
+{
+	YAML::Emitter *_out;
+	YAML::Node *_doc;
+public:
+	/// Creates a writer for an emitter or a node.
+	SaveWriter(YAML::Emitter *out, YAML::Node *doc) : _out(out), _doc(doc)
+	{
+	}
+
+	/**
+	 * Writes a single key and value into the map.
+	 * Value is converted the same way as assigning it to a YAML::Node would do.
+	 */
+	template<typename T>
+	void add(const std::string &key, const T &value)
+	{
+		if (_out)
+		{
+			*_out << YAML::Key << key << YAML::Value << YAML::Node(value);
+		}
+		else
+		{
+			(*_doc)[key] = value;
+		}
+	}
+
+	/**
+	 * Writes all entries of a map node into the map.
+	 */
+	void addEntries(const YAML::Node &node)
+	{
+		for (const auto& pair : node)
+		{
+			add(pair.first.as<std::string>(), pair.second);
+		}
+	}
+
+	/**
+	 * Writes a list of objects into the map.
+	 * When streaming, each object is converted to a node and written right away,
+	 * so only one object tree is kept in memory at a time.
+	 * Empty lists are skipped like absent keys in a node tree.
+	 */
+	template<typename C, typename F>
+	void addSequence(const std::string &key, const C &list, F &&save)
+	{
+		if (list.empty())
+		{
+			return;
+		}
+		if (_out)
+		{
+			*_out << YAML::Key << key << YAML::Value << YAML::BeginSeq;
+			for (const auto* obj : list)
+			{
+				*_out << save(obj);
+			}
+			*_out << YAML::EndSeq;
+		}
+		else
+		{
+			YAML::Node seq = (*_doc)[key];
+			for (const auto* obj : list)
+			{
+				seq.push_back(save(obj));
+			}
+		}
+	}
+};
+
 }
 
 /**
@@ -282,6 +355,8 @@ static bool _isCurrentGameType(const SaveInfo &saveInfo, const std::string &curM
 
 /**
  * Gets all the info of the saves found in the user folder.
+ * The brief headers are cached in an index file next to the saves,
+ * so only new or modified saves (by time and size) need to be opened.
  * @param lang Loaded language.
  * @param autoquick Include autosaves and quicksaves.
  * @return List of saves info.
@@ -291,18 +366,58 @@ std::vector<SaveInfo> SavedGame::getList(Language *lang, bool autoquick)
 	std::vector<SaveInfo> info;
 	std::string curMaster = Options::getActiveMaster();
 	auto saves = CrossPlatform::getFolderContents(Options::getMasterUserFolder(), "sav");
+	auto asaves = CrossPlatform::getFolderContents(Options::getMasterUserFolder(), "asav");
+	saves.insert(saves.begin(), asaves.begin(), asaves.end());
 
-	if (autoquick)
+	std::string indexPath = Options::getMasterUserFolder() + SAVE_INDEX;
+	YAML::Node index;
+	if (CrossPlatform::fileExists(indexPath))
 	{
-		auto asaves = CrossPlatform::getFolderContents(Options::getMasterUserFolder(), "asav");
-		saves.insert(saves.begin(), asaves.begin(), asaves.end());
+		try
+		{
+			index = YAML::Load(*CrossPlatform::readFile(indexPath));
+		}
+		catch (Exception &e)
+		{
+			Log(LOG_WARNING) << indexPath << ": " << e.what();
+		}
+		catch (YAML::Exception &e)
+		{
+			Log(LOG_WARNING) << indexPath << ": " << e.what();
+		}
 	}
+	const YAML::Node &oldIndex = index;
+	YAML::Node newIndex;
+	bool changed = false;
+
 	for (const auto& tuple : saves)
 	{
 		const auto& filename = std::get<0>(tuple);
+		const auto& timestamp = std::get<2>(tuple);
 		try
 		{
-			SaveInfo saveInfo = getSaveInfo(filename, lang);
+			// modification times only have one second resolution, the size catches most saves overwritten within the same second
+			const Uint64 size = CrossPlatform::getFileSize(Options::getMasterUserFolder() + filename);
+			YAML::Node brief;
+			const YAML::Node &cached = oldIndex.IsMap() ? oldIndex[filename] : YAML::Node();
+			if (cached.IsMap() && cached["mtime"].as<time_t>(0) == timestamp && cached["size"].as<Uint64>(0) == size && cached["brief"])
+			{
+				brief = cached["brief"];
+			}
+			else
+			{
+				brief = YAML::Load(*CrossPlatform::getYamlSaveHeader(Options::getMasterUserFolder() + filename));
+				changed = true;
+			}
+			newIndex[filename]["mtime"] = timestamp;
+			newIndex[filename]["size"] = size;
+			newIndex[filename]["brief"] = brief;
+
+			if (!autoquick && CrossPlatform::compareExt(filename, "asav"))
+			{
+				continue;
+			}
+			SaveInfo saveInfo = getSaveInfo(filename, brief, timestamp, lang);
 			if (!_isCurrentGameType(saveInfo, curMaster))
 			{
 				continue;
@@ -321,18 +436,28 @@ std::vector<SaveInfo> SavedGame::getList(Language *lang, bool autoquick)
 		}
 	}
 
+	if (changed || newIndex.size() != oldIndex.size())
+	{
+		YAML::Emitter out;
+		out << newIndex;
+		if (!CrossPlatform::writeFile(indexPath, out.c_str()))
+		{
+			Log(LOG_WARNING) << "Failed to update " << indexPath;
+		}
+	}
+
 	return info;
 }
 
 /**
  * Gets the info of a specific save file.
  * @param file Save filename.
+ * @param doc Brief header of the save.
+ * @param timestamp Modification time of the save.
  * @param lang Loaded language.
  */
-SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
+SaveInfo SavedGame::getSaveInfo(const std::string &file, const YAML::Node &doc, time_t timestamp, Language *lang)
 {
-	std::string fullname = Options::getMasterUserFolder() + file;
-	YAML::Node doc = YAML::Load(*CrossPlatform::getYamlSaveHeader(fullname));
 	SaveInfo save;
 
 	save.fileName = file;
@@ -375,7 +500,7 @@ SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
 		save.reserved = false;
 	}
 
-	save.timestamp = CrossPlatform::getDateModified(fullname);
+	save.timestamp = timestamp;
 	std::pair<std::string, std::string> str = CrossPlatform::timeToString(save.timestamp);
 	save.isoDate = str.first;
 	save.isoTime = str.second;
@@ -414,7 +539,7 @@ SaveInfo SavedGame::getSaveInfo(const std::string &file, Language *lang)
 void SavedGame::load(const std::string &filename, Mod *mod, Language *lang)
 {
 	std::string filepath = Options::getMasterUserFolder() + filename;
-	std::vector<YAML::Node> file = YAML::LoadAll(*CrossPlatform::readFile(filepath));
+	std::vector<YAML::Node> file = YAML::LoadAll(*CrossPlatform::readSaveFile(filepath));
 	// Get brief save info
 	YAML::Node brief = file[0];
 	_time->load(brief["time"]);
@@ -806,9 +931,19 @@ void SavedGame::load(const std::string &filename, Mod *mod, Language *lang)
  */
 void SavedGame::save(const std::string &filename, Mod *mod) const
 {
-	YAML::Emitter out;
+	std::string filepath = Options::getMasterUserFolder() + filename;
+	if (!CrossPlatform::writeSaveFile(filepath, serialize(mod), Options::oxceCompressedSaves))
+	{
+		throw Exception("Failed to save " + filepath);
+	}
+}
 
-	// Saves the brief game info used in the saves list
+/**
+ * Saves the brief game info used in the saves list.
+ * @return YAML node.
+ */
+YAML::Node SavedGame::saveBrief() const
+{
 	YAML::Node brief;
 	brief["name"] = _name;
 	brief["version"] = OPENXCOM_VERSION_SHORT;
@@ -837,127 +972,101 @@ void SavedGame::save(const std::string &filename, Mod *mod) const
 	brief["mods"] = modsList;
 	if (_ironman)
 		brief["ironman"] = _ironman;
-	out << brief;
-	// Saves the full game data to the save
-	out << YAML::BeginDoc;
-	YAML::Node node;
-	node["difficulty"] = (int)_difficulty;
-	node["end"] = (int)_end;
-	node["monthsPassed"] = _monthsPassed;
-	node["graphRegionToggles"] = _graphRegionToggles;
-	node["graphCountryToggles"] = _graphCountryToggles;
-	node["graphFinanceToggles"] = _graphFinanceToggles;
-	node["rng"] = RNG::getSeed();
-	node["funds"] = _funds;
-	node["maintenance"] = _maintenance;
-	node["userNotes"] = _userNotes;
-	if (Options::oxceGeoscapeDebugLogMaxEntries > 0)
+	return brief;
+}
+
+/**
+ * Writes the full game data of a save, either streamed
+ * into an emitter or collected into a node.
+ * Big lists are streamed one object at a time instead of building a node tree for the whole game.
+ * @param out Emitter with the game data map open, or null.
+ * @param doc Node to collect the game data into, if no emitter.
+ * @param mod Mod for the saved game.
+ */
+void SavedGame::saveContents(YAML::Emitter *out, YAML::Node *doc, Mod *mod) const
+{
+	SaveWriter writer(out, doc);
 	{
-		if (_geoscapeDebugLog.size() > (size_t)Options::oxceGeoscapeDebugLogMaxEntries)
+		YAML::Node node;
+		node["difficulty"] = (int)_difficulty;
+		node["end"] = (int)_end;
+		node["monthsPassed"] = _monthsPassed;
+		node["graphRegionToggles"] = _graphRegionToggles;
+		node["graphCountryToggles"] = _graphCountryToggles;
+		node["graphFinanceToggles"] = _graphFinanceToggles;
+		node["rng"] = RNG::getSeed();
+		node["funds"] = _funds;
+		node["maintenance"] = _maintenance;
+		node["userNotes"] = _userNotes;
+		if (Options::oxceGeoscapeDebugLogMaxEntries > 0)
 		{
-			for (size_t j = _geoscapeDebugLog.size() - (size_t)Options::oxceGeoscapeDebugLogMaxEntries; j < _geoscapeDebugLog.size(); ++j)
+			if (_geoscapeDebugLog.size() > (size_t)Options::oxceGeoscapeDebugLogMaxEntries)
 			{
-				node["geoscapeDebugLog"].push_back(_geoscapeDebugLog[j]);
+				for (size_t j = _geoscapeDebugLog.size() - (size_t)Options::oxceGeoscapeDebugLogMaxEntries; j < _geoscapeDebugLog.size(); ++j)
+				{
+					node["geoscapeDebugLog"].push_back(_geoscapeDebugLog[j]);
+				}
+			}
+			else
+			{
+				node["geoscapeDebugLog"] = _geoscapeDebugLog;
 			}
 		}
-		else
-		{
-			node["geoscapeDebugLog"] = _geoscapeDebugLog;
-		}
-	}
-	node["researchScores"] = _researchScores;
-	node["incomes"] = _incomes;
-	node["expenditures"] = _expenditures;
-	node["warned"] = _warned;
-	node["togglePersonalLight"] = _togglePersonalLight;
-	node["toggleNightVision"] = _toggleNightVision;
-	node["toggleBrightness"] = _toggleBrightness;
-	node["globeLon"] = serializeDouble(_globeLon);
-	node["globeLat"] = serializeDouble(_globeLat);
-	node["globeZoom"] = _globeZoom;
-	node["ids"] = _ids;
-	for (const auto* country : _countries)
-	{
-		node["countries"].push_back(country->save(mod->getScriptGlobal()));
-	}
-	for (const auto* region : _regions)
-	{
-		node["regions"].push_back(region->save());
-	}
-	for (const auto* xbase : _bases)
-	{
-		node["bases"].push_back(xbase->save());
-	}
-	for (const auto* wp : _waypoints)
-	{
-		node["waypoints"].push_back(wp->save());
-	}
-	for (const auto* site : _missionSites)
-	{
-		node["missionSites"].push_back(site->save());
-	}
+		node["researchScores"] = _researchScores;
+		node["incomes"] = _incomes;
+		node["expenditures"] = _expenditures;
+		node["warned"] = _warned;
+		node["togglePersonalLight"] = _togglePersonalLight;
+		node["toggleNightVision"] = _toggleNightVision;
+		node["toggleBrightness"] = _toggleBrightness;
+		node["globeLon"] = serializeDouble(_globeLon);
+		node["globeLat"] = serializeDouble(_globeLat);
+		node["globeZoom"] = _globeZoom;
+		node["ids"] = _ids;
+		writer.addEntries(node);
+	}
+	writer.addSequence("countries", _countries, [&](const Country* country) { return country->save(mod->getScriptGlobal()); });
+	writer.addSequence("regions", _regions, [](const Region* region) { return region->save(); });
+	writer.addSequence("bases", _bases, [](const Base* xbase) { return xbase->save(); });
+	writer.addSequence("waypoints", _waypoints, [](const Waypoint* wp) { return wp->save(); });
+	writer.addSequence("missionSites", _missionSites, [](const MissionSite* site) { return site->save(); });
 	// Alien bases must be saved before alien missions.
-	for (const auto* ab : _alienBases)
-	{
-		node["alienBases"].push_back(ab->save());
-	}
+	writer.addSequence("alienBases", _alienBases, [](const AlienBase* ab) { return ab->save(); });
 	// Missions must be saved before UFOs, but after alien bases.
-	for (const auto* am : _activeMissions)
-	{
-		node["alienMissions"].push_back(am->save());
-	}
+	writer.addSequence("alienMissions", _activeMissions, [](const AlienMission* am) { return am->save(); });
 	// UFOs must be after missions
-	for (const auto* ufo : _ufos)
-	{
-		node["ufos"].push_back(ufo->save(mod->getScriptGlobal(), getMonthsPassed() == -1));
-	}
-	for (const auto* ge : _geoscapeEvents)
-	{
-		node["geoscapeEvents"].push_back(ge->save());
-	}
-	for (const auto* research : _discovered)
-	{
-		node["discovered"].push_back(research->getName());
-	}
-	for (const auto* research : _poppedResearch)
-	{
-		node["poppedResearch"].push_back(research->getName());
-	}
-	node["generatedEvents"] = _generatedEvents;
-	node["ufopediaRuleStatus"] = _ufopediaRuleStatus;
-	node["manufactureRuleStatus"] = _manufactureRuleStatus;
-	node["researchRuleStatus"] = _researchRuleStatus;
-	node["monthlyPurchaseLimitLog"] = _monthlyPurchaseLimitLog;
-	node["hiddenPurchaseItems"] = _hiddenPurchaseItemsMap;
-	node["customRuleCraftDeployments"] = _customRuleCraftDeployments;
-	node["alienStrategy"] = _alienStrategy->save();
-	for (const auto* soldier : _deadSoldiers)
-	{
-		node["deadSoldiers"].push_back(soldier->save(mod->getScriptGlobal()));
-	}
+	writer.addSequence("ufos", _ufos, [&](const Ufo* ufo) { return ufo->save(mod->getScriptGlobal(), getMonthsPassed() == -1); });
+	writer.addSequence("geoscapeEvents", _geoscapeEvents, [](const GeoscapeEvent* ge) { return ge->save(); });
+	writer.addSequence("discovered", _discovered, [](const RuleResearch* research) { return YAML::Node(research->getName()); });
+	writer.addSequence("poppedResearch", _poppedResearch, [](const RuleResearch* research) { return YAML::Node(research->getName()); });
+	writer.add("generatedEvents", _generatedEvents);
+	writer.add("ufopediaRuleStatus", _ufopediaRuleStatus);
+	writer.add("manufactureRuleStatus", _manufactureRuleStatus);
+	writer.add("researchRuleStatus", _researchRuleStatus);
+	writer.add("monthlyPurchaseLimitLog", _monthlyPurchaseLimitLog);
+	writer.add("hiddenPurchaseItems", _hiddenPurchaseItemsMap);
+	writer.add("customRuleCraftDeployments", _customRuleCraftDeployments);
+	writer.add("alienStrategy", _alienStrategy->save());
+	writer.addSequence("deadSoldiers", _deadSoldiers, [&](const Soldier* soldier) { return soldier->save(mod->getScriptGlobal()); });
 	for (int j = 0; j < Options::oxceMaxEquipmentLayoutTemplates; ++j)
 	{
 		std::ostringstream oss;
 		oss << "globalEquipmentLayout" << j;
 		std::string key = oss.str();
-		if (!_globalEquipmentLayout[j].empty())
-		{
-			for (const auto* entry : _globalEquipmentLayout[j])
-				node[key].push_back(entry->save());
-		}
+		writer.addSequence(key, _globalEquipmentLayout[j], [](const EquipmentLayoutItem* entry) { return entry->save(); });
 		std::ostringstream oss2;
 		oss2 << "globalEquipmentLayoutName" << j;
 		std::string key2 = oss2.str();
 		if (!_globalEquipmentLayoutName[j].empty())
 		{
-			node[key2] = _globalEquipmentLayoutName[j];
+			writer.add(key2, _globalEquipmentLayoutName[j]);
 		}
 		std::ostringstream oss3;
 		oss3 << "globalEquipmentLayoutArmor" << j;
 		std::string key3 = oss3.str();
 		if (!_globalEquipmentLayoutArmor[j].empty())
 		{
-			node[key3] = _globalEquipmentLayoutArmor[j];
+			writer.add(key3, _globalEquipmentLayoutArmor[j]);
 		}
 	}
 	for (int j = 0; j < MAX_CRAFT_LOADOUT_TEMPLATES; ++j)
@@ -965,29 +1074,23 @@ void SavedGame::save(const std::string &filename, Mod *mod) const
 		std::ostringstream oss;
 		oss << "globalCraftLoadout" << j;
 		std::string key = oss.str();
-		if (!_globalCraftLoadout[j]->getContents()->empty())
+		if (!_globalCraftLoadout[j]->empty())
 		{
-			node[key] = _globalCraftLoadout[j]->save();
+			writer.add(key, _globalCraftLoadout[j]->save());
 		}
 		std::ostringstream oss2;
 		oss2 << "globalCraftLoadoutName" << j;
 		std::string key2 = oss2.str();
 		if (!_globalCraftLoadoutName[j].empty())
 		{
-			node[key2] = _globalCraftLoadoutName[j];
+			writer.add(key2, _globalCraftLoadoutName[j]);
 		}
 	}
 	if (Options::soldierDiaries)
 	{
-		for (const auto* ms : _missionStatistics)
-		{
-			node["missionStatistics"].push_back(ms->save());
-		}
-	}
-	for (const auto* ruleItem : _autosales)
-	{
-		node["autoSales"].push_back(ruleItem->getName());
+		writer.addSequence("missionStatistics", _missionStatistics, [](const MissionStatistics* ms) { return ms->save(); });
 	}
+	writer.addSequence("autoSales", _autosales, [](const RuleItem* ruleItem) { return YAML::Node(ruleItem->getName()); });
 	// snapshot of the user options (just for debugging purposes)
 	{
 		YAML::Node tmpNode;
@@ -995,22 +1098,64 @@ void SavedGame::save(const std::string &filename, Mod *mod) const
 		{
 			info.save(tmpNode);
 		}
-		node["options"] = tmpNode;
+		writer.add("options", tmpNode);
 	}
 	if (_battleGame != 0)
 	{
-		node["battleGame"] = _battleGame->save();
+		writer.add("battleGame", _battleGame->save());
 	}
-	_scriptValues.save(node, mod->getScriptGlobal());
+	{
+		YAML::Node node;
+		_scriptValues.save(node, mod->getScriptGlobal());
+		writer.addEntries(node);
+	}
+}
 
-	out << node;
+/**
+ * Serializes a saved game's contents to YAML.
+ * @param mod Mod for the saved game.
+ * @return YAML contents of the save file.
+ */
+std::string SavedGame::serialize(Mod *mod) const
+{
+	YAML::Emitter out;
+	out << saveBrief();
+	// Saves the full game data to the save
+	out << YAML::BeginDoc;
+	out << YAML::BeginMap;
+	saveContents(&out, nullptr, mod);
+	out << YAML::EndMap;
+	return std::string(out.c_str(), out.size());
+}
 
+/**
+ * Takes a snapshot of a saved game's contents as node trees.
+ * Unlike the game itself, the snapshot can be emitted on another thread
+ * while the game goes on (see emitSnapshot).
+ * @param brief Gets the brief game info.
+ * @param doc Gets the full game data.
+ * @param mod Mod for the saved game.
+ */
+void SavedGame::snapshot(YAML::Node &brief, YAML::Node &doc, Mod *mod) const
+{
+	brief = saveBrief();
+	doc = YAML::Node(YAML::NodeType::Map);
+	saveContents(nullptr, &doc, mod);
+}
 
-	std::string filepath = Options::getMasterUserFolder() + filename;
-	if (!CrossPlatform::writeFile(filepath, out.c_str()))
-	{
-		throw Exception("Failed to save " + filepath);
-	}
+/**
+ * Serializes a saved game snapshot to YAML.
+ * @param brief Brief game info.
+ * @param doc Full game data.
+ * @return YAML contents of the save file.
+ */
+std::string SavedGame::emitSnapshot(const YAML::Node &brief, const YAML::Node &doc)
+{
+	YAML::Emitter out;
+	out << brief;
+	out << YAML::BeginDoc;
+	out << doc;
+	return std::string(out.c_str(), out.size());
 }
 
 /**
@@ -1607,8 +1752,7 @@ void SavedGame::removeDiscoveredResearch(const RuleResearch * research)
  */
 void SavedGame::addFinishedResearchSimple(const RuleResearch * research)
 {
-	_discovered.push_back(research);
-	sortReserchVector(_discovered);
+	addReserchVector(_discovered, research);
 }
 
 /**
@@ -1637,6 +1781,9 @@ void SavedGame::addFinishedResearch(const RuleResearch * research, const Mod * m
 	// Not really a queue in C++ terminology (we don't need or want pop_front())
 	std::vector<const RuleResearch *> queue;
 	queue.push_back(research);
+	// Same topics as in the queue, but sorted for fast lookup
+	std::vector<const RuleResearch *> queued;
+	queued.push_back(research);
 
 	size_t currentQueueIndex = 0;
 	while (queue.size() > currentQueueIndex)
@@ -1651,8 +1798,7 @@ void SavedGame::addFinishedResearch(const RuleResearch * research, const Mod * m
 		bool checkRelatedZeroCostTopics = true;
 		if (!isResearched(currentQueueItem, false))
 		{
-			_discovered.push_back(currentQueueItem);
-			sortReserchVector(_discovered);
+			addReserchVector(_discovered, currentQueueItem);
 			if (!hasUndiscoveredProtectedUnlocks && !hasAnyUndiscoveredGetOneFrees)
 			{
 				// If the currentQueueItem can't tell you anything anymore, remove it from popped research
@@ -1708,34 +1854,24 @@ void SavedGame::addFinishedResearch(const RuleResearch * research, const Mod * m
 				if (projectToTest->getCost() == 0)
 				{
 					// We are only interested in *new* projects (i.e. not processed or scheduled for processing yet)
-					bool isAlreadyInTheQueue = false;
-					for (const RuleResearch* res : queue)
-					{
-						if (res->getName() == projectToTest->getName())
-						{
-							isAlreadyInTheQueue = true;
-							break;
-						}
-					}
-
-					if (!isAlreadyInTheQueue)
+					if (!haveReserchVector(queued, projectToTest))
 					{
+						bool addToQueue = false;
 						if (projectToTest->getRequirements().empty())
 						{
 							// no additional checks for "unprotected" topics
-							queue.push_back(projectToTest);
+							addToQueue = true;
 						}
 						else
 						{
 							// for "protected" topics, we need to check if the currentQueueItem can unlock it or not
-							for (const auto* unl : currentQueueItem->getUnlocked())
-							{
-								if (projectToTest == unl)
-								{
-									queue.push_back(projectToTest);
-									break;
-								}
-							}
+							const auto& unlocked = currentQueueItem->getUnlocked();
+							addToQueue = std::find(unlocked.begin(), unlocked.end(), projectToTest) != unlocked.end();
+						}
+						if (addToQueue)
+						{
+							queue.push_back(projectToTest);
+							addReserchVector(queued, projectToTest);
 						}
 					}
 				}
@@ -1774,7 +1910,20 @@ void SavedGame::getAvailableResearchProjects(std::vector<RuleResearch *> &projec
 		{
 			unlocked.push_back(unl);
 		}
-		sortReserchVector(unlocked);
+	}
+	sortReserchVector(unlocked);
+
+	// Base functions and running projects do not change while scanning the topics, get them only once
+	RuleBaseFacilityFunctions providedBaseFunc;
+	std::vector<const RuleResearch *> baseResearch;
+	if (base)
+	{
+		providedBaseFunc = base->getProvidedBaseFunc({});
+		for (const auto* project : base->getResearch())
+		{
+			baseResearch.push_back(project->getRules());
+		}
+		sortReserchVector(baseResearch);
 	}
 
 	// Create a list of research topics available for research in the given base
@@ -1813,7 +1962,7 @@ void SavedGame::getAvailableResearchProjects(std::vector<RuleResearch *> &projec
 		}
 
 		// Remove the already researched topics from the list *UNLESS* they can still give you something more
-		if (isResearched(research->getName(), false))
+		if (isResearched(research, false))
 		{
 			if (hasUndiscoveredGetOneFree(research, true))
 			{
@@ -1833,8 +1982,7 @@ void SavedGame::getAvailableResearchProjects(std::vector<RuleResearch *> &projec
 		if (base)
 		{
 			// Check if this topic is already being researched in the given base
-			const std::vector<ResearchProject *> & baseResearchProjects = base->getResearch();
-			if (std::find_if(baseResearchProjects.begin(), baseResearchProjects.end(), findRuleResearch(research)) != baseResearchProjects.end())
+			if (haveReserchVector(baseResearch, research))
 			{
 				continue;
 			}
@@ -1846,7 +1994,7 @@ void SavedGame::getAvailableResearchProjects(std::vector<RuleResearch *> &projec
 			}
 
 			// Check for required buildings/functions in the given base
-			if ((~base->getProvidedBaseFunc({}) & research->getRequireBaseFunc()).any())
+			if ((~providedBaseFunc & research->getRequireBaseFunc()).any())
 			{
 				continue;
 			}
@@ -2431,8 +2579,10 @@ int SavedGame::getSoldierIdleDays(const Soldier *soldier)
 	if (lastMissionId == -1)
 		return idleDays;
 
-	for (const auto* missionInfo : _missionStatistics)
+	// the last mission is usually a recent one, look from the end
+	for (auto it = _missionStatistics.rbegin(); it != _missionStatistics.rend(); ++it)
 	{
+		const auto* missionInfo = *it;
 		if (missionInfo->id == lastMissionId)
 		{
 			idleDays = 0;
@@ -174,9 +174,13 @@ private:
 	bool _alienContainmentChecked;
 	ScriptValues<SavedGame> _scriptValues;
 
-	static SaveInfo getSaveInfo(const std::string &file, Language *lang);
+	static SaveInfo getSaveInfo(const std::string &file, const YAML::Node &doc, time_t timestamp, Language *lang);
+	/// Saves the brief game info used in the saves list.
+	YAML::Node saveBrief() const;
+	/// Writes the full game data to an emitter or a node.
+	void saveContents(YAML::Emitter *out, YAML::Node *doc, Mod *mod) const;
 public:
-	static const std::string AUTOSAVE_GEOSCAPE, AUTOSAVE_BATTLESCAPE, QUICKSAVE;
+	static const std::string AUTOSAVE_GEOSCAPE, AUTOSAVE_BATTLESCAPE, QUICKSAVE, SAVE_INDEX;
 	/// Creates a new saved game.
 	SavedGame();
 	/// Cleans up the saved game.
@@ -189,6 +193,12 @@ public:
 	void load(const std::string &filename, Mod *mod, Language *lang);
 	/// Saves a saved game to YAML.
 	void save(const std::string &filename, Mod *mod) const;
+	/// Serializes a saved game to YAML.
+	std::string serialize(Mod *mod) const;
+	/// Takes a snapshot of a saved game to serialize later.
+	void snapshot(YAML::Node &brief, YAML::Node &doc, Mod *mod) const;
+	/// Serializes a saved game snapshot to YAML.
+	static std::string emitSnapshot(const YAML::Node &brief, const YAML::Node &doc);
 	/// Gets the game name.
 	std::string getName() const;
 	/// Sets the game name.
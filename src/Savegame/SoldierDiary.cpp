@@ -79,8 +79,8 @@ void SoldierDiary::load(const YAML::Node& node, const Mod *mod)
 	}
 	if (const YAML::Node &killList = node["killList"])
 	{
-		for (YAML::const_iterator i = killList.begin(); i != killList.end(); ++i)
-			_killList.push_back(new BattleUnitKills(*i));
+		// kill lists are big and rarely needed, keep them undecoded until then
+		_killListNode = YAML::Clone(killList);
 	}
 	_missionIdList = node["missionIdList"].as<std::vector<int> >(_missionIdList);
 	_daysWoundedTotal = node["daysWoundedTotal"].as<int>(_daysWoundedTotal);
@@ -130,6 +130,11 @@ YAML::Node SoldierDiary::save() const
 	{
 		node["commendations"].push_back(comm->save());
 	}
+	if (_killListNode.IsSequence())
+	{
+		// never share the undecoded list with the output, kills appended below would end up in it
+		node["killList"] = YAML::Clone(_killListNode);
+	}
 	for (const auto* buk : _killList)
 	{
 		node["killList"].push_back(buk->save());
@@ -182,6 +187,7 @@ void SoldierDiary::updateDiary(BattleUnitStatistics *unitStatistics, std::vector
 	if (allMissionStatistics->empty()) return;
 	auto* missionStatistics = allMissionStatistics->back();
 	auto& unitKills = unitStatistics->kills;
+	getKillList();
 	for (auto* buk : unitKills)
 	{
 		buk->makeTurnUnique();
@@ -282,6 +288,18 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 	std::map<std::string, int> nextCommendationLevel;   // Noun, threshold.
 	std::vector<std::string> modularCommendations;      // Noun.
 	bool awardCommendationBool = false;                 // This value determines if a commendation will be given.
+
+	// Kill and mission totals do not change while commendations are awarded,
+	// so each one is gathered once, when a criteria first needs it.
+	std::map<std::string, std::map<std::string, int> > nounTotals; // Criteria name, totals by noun.
+	struct KillDetails
+	{
+		std::string status, faction, side, bodyPart;
+		const std::string *battleType, *damageType;
+	};
+	std::vector<KillDetails> killDetails;
+	bool killDetailsReady = false;
+
 	// Loop over all possible commendations
 	for (auto iter = commendationsList.begin(); iter != commendationsList.end(); )
 	{
@@ -377,15 +395,21 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 			// And because they loop over a map<> (this allows for maximum moddability).
 			else if (critName == "totalKillsWithAWeapon" || critName == "totalMissionsInARegion" || critName == "totalKillsByRace" || critName == "totalKillsByRank")
 			{
-				std::map<std::string, int> tempTotal;
-				if (critName == "totalKillsWithAWeapon")
-					tempTotal = getWeaponTotal();
-				else if (critName == "totalMissionsInARegion")
-					tempTotal = getRegionTotal(missionStatistics);
-				else if (critName == "totalKillsByRace")
-					tempTotal = getAlienRaceTotal();
-				else if (critName == "totalKillsByRank")
-					tempTotal = getAlienRankTotal();
+				auto found = nounTotals.find(critName);
+				if (found == nounTotals.end())
+				{
+					std::map<std::string, int> total;
+					if (critName == "totalKillsWithAWeapon")
+						total = getWeaponTotal();
+					else if (critName == "totalMissionsInARegion")
+						total = getRegionTotal(missionStatistics);
+					else if (critName == "totalKillsByRace")
+						total = getAlienRaceTotal();
+					else if (critName == "totalKillsByRank")
+						total = getAlienRankTotal();
+					found = nounTotals.emplace(critName, std::move(total)).first;
+				}
+				const std::map<std::string, int> &tempTotal = found->second;
 				// Loop over the temporary map.
 				// Match nouns and decoration levels.
 				for (const auto& pair : tempTotal)
@@ -420,6 +444,48 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 					break;
 				const auto* _killCriteriaList = commRule->getKillCriteria();
 
+				// Describe every kill once, instead of once per criteria detail.
+				if (!killDetailsReady)
+				{
+					killDetailsReady = true;
+					killDetails.reserve(getKillList().size());
+					for (const auto* singleKill : getKillList())
+					{
+						KillDetails details = { singleKill->getUnitStatusString(), singleKill->getUnitFactionString(), singleKill->getUnitSideString(), singleKill->getUnitBodyPartString(), nullptr, nullptr };
+
+						// the weapon's battle type and damage type
+						RuleItem *weapon = mod->getItem(singleKill->weapon);
+						if (weapon != 0)
+						{
+							int battleType = weapon->getBattleType();
+							if (battleType >= 0 && battleType < BATTLE_TYPES)
+							{
+								details.battleType = &battleTypeArray[battleType];
+							}
+
+							RuleItem *weaponAmmo = mod->getItem(singleKill->weaponAmmo);
+							int damageType = -1;
+
+							if (weaponAmmo != 0)
+							{
+								damageType = weaponAmmo->getDamageType()->ResistType;
+							}
+							else if (singleKill->weaponAmmo == "__GUNBUTT")
+							{
+								// If weaponAmmo == "__GUNBUTT", that means the gun's secondary melee attack was used.
+								damageType = weapon->getMeleeType()->ResistType;
+							}
+							// If we were unable to determine the damage type, leave it as -1.
+
+							if (damageType >= 0 && damageType < DAMAGE_TYPES)
+							{
+								details.damageType = &damageTypeArray[damageType];
+							}
+						}
+						killDetails.push_back(std::move(details));
+					}
+				}
+
 				int totalKillGroups = 0; // holds the total number of kill groups which satisfy one of the OR criteria blocks
 				bool enoughForNextCommendation = false;
 
@@ -445,8 +511,10 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 					int lastTimeSpan = -1;
 					bool skipThisTimeSpan = false;
 					// Loop over the KILLS, seeking to fulfill all criteria from entire AND block within the specified time span (career/mission/turn)
-					for (const auto* singleKill : _killList)
+					for (size_t killIndex = 0; killIndex < getKillList().size(); ++killIndex)
 					{
+						const auto* singleKill = getKillList()[killIndex];
+						const auto& details = killDetails[killIndex];
 						int thisTimeSpan = -1;
 						if (critName == "killsWithCriteriaMission")
 						{
@@ -489,47 +557,20 @@ bool SoldierDiary::manageCommendations(Mod *mod, std::vector<MissionStatistics*>
 									singleKill->race == detail ||
 									singleKill->weapon == detail ||
 									singleKill->weaponAmmo == detail ||
-									singleKill->getUnitStatusString() == detail ||
-									singleKill->getUnitFactionString() == detail ||
-									singleKill->getUnitSideString() == detail ||
-									singleKill->getUnitBodyPartString() == detail)
+									details.status == detail ||
+									details.faction == detail ||
+									details.side == detail ||
+									details.bodyPart == detail)
 								{
 									// Found match
 									continue;
 								}
 
 								// check the weapon's battle type and damage type
-								RuleItem *weapon = mod->getItem(singleKill->weapon);
-								if (weapon != 0)
+								if ((details.battleType && *details.battleType == detail) ||
+									(details.damageType && *details.damageType == detail))
 								{
-									int battleType = weapon->getBattleType();
-
-									if (battleType >=0 && battleType < BATTLE_TYPES && battleTypeArray[battleType] == detail)
-									{
-										// the detail matched the weapon's battle type
-										continue;
-									}
-
-
-									RuleItem *weaponAmmo = mod->getItem(singleKill->weaponAmmo);
-									int damageType = -1;
-
-									if (weaponAmmo != 0)
-									{
-										damageType = weaponAmmo->getDamageType()->ResistType;
-									}
-									else if (singleKill->weaponAmmo == "__GUNBUTT")
-									{
-										// If weaponAmmo == "__GUNBUTT", that means the gun's secondary melee attack was used.
-										damageType = weapon->getMeleeType()->ResistType;
-									}
-									// If we were unable to determine the damage type, leave it as -1.
-
-									if (damageType >= 0 && damageType < DAMAGE_TYPES && damageTypeArray[damageType] == detail)
-									{
-										// the detail matched the damage type
-										continue;
-									}
+									continue;
 								}
 
 								// That's all we can check. We didn't find a match
@@ -647,6 +688,22 @@ const std::vector<int>& SoldierDiary::getMissionIdList() const
  */
 std::vector<BattleUnitKills*> &SoldierDiary::getKills()
 {
+	getKillList();
+	return _killList;
+}
+
+/**
+ * Get vector of kills, decoding it first if it was not needed since loading.
+ * @return vector of BattleUnitKills
+ */
+const std::vector<BattleUnitKills*> &SoldierDiary::getKillList() const
+{
+	if (_killListNode.IsSequence())
+	{
+		for (YAML::const_iterator i = _killListNode.begin(); i != _killListNode.end(); ++i)
+			_killList.push_back(new BattleUnitKills(*i));
+	}
+	_killListNode.reset();
 	return _killList;
 }
 
@@ -657,7 +714,7 @@ std::vector<BattleUnitKills*> &SoldierDiary::getKills()
 std::map<std::string, int> SoldierDiary::getAlienRankTotal() const
 {
 	std::map<std::string, int> list;
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		list[buk->rank]++;
 	}
@@ -670,7 +727,7 @@ std::map<std::string, int> SoldierDiary::getAlienRankTotal() const
 std::map<std::string, int> SoldierDiary::getAlienRaceTotal() const
 {
 	std::map<std::string, int> list;
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		list[buk->race]++;
 	}
@@ -683,7 +740,7 @@ std::map<std::string, int> SoldierDiary::getAlienRaceTotal() const
 std::map<std::string, int> SoldierDiary::getWeaponTotal() const
 {
 	std::map<std::string, int> list;
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->faction == FACTION_HOSTILE)
 			list[buk->weapon]++;
@@ -697,7 +754,7 @@ std::map<std::string, int> SoldierDiary::getWeaponTotal() const
 std::map<std::string, int> SoldierDiary::getWeaponAmmoTotal() const
 {
 	std::map<std::string, int> list;
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->faction == FACTION_HOSTILE)
 			list[buk->weaponAmmo]++;
@@ -800,7 +857,7 @@ int SoldierDiary::getKillTotal() const
 {
 	int killTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->status == STATUS_DEAD && buk->faction == FACTION_HOSTILE)
 		{
@@ -896,7 +953,7 @@ int SoldierDiary::getStunTotal() const
 {
 	int stunTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->status == STATUS_UNCONSCIOUS && buk->faction == FACTION_HOSTILE)
 		{
@@ -914,7 +971,7 @@ int SoldierDiary::getPanickTotal() const
 {
 	int panickTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->status == STATUS_PANICKING && buk->faction == FACTION_HOSTILE)
 		{
@@ -932,7 +989,7 @@ int SoldierDiary::getControlTotal() const
 {
 	int controlTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		if (buk->status == STATUS_TURNING && buk->faction == FACTION_HOSTILE)
 		{
@@ -1033,7 +1090,7 @@ int SoldierDiary::getTrapKillTotal(Mod *mod) const
 {
 	int trapKillTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		RuleItem *item = mod->getItem(buk->weapon);
 		if (buk->hostileTurn() && (item == 0 || item->getBattleType() == BT_GRENADE || item->getBattleType() == BT_PROXIMITYGRENADE))
@@ -1052,7 +1109,7 @@ int SoldierDiary::getTrapKillTotal(Mod *mod) const
  {
 	int reactionFireKillTotal = 0;
 
-	for (const auto* buk : _killList)
+	for (const auto* buk : getKillList())
 	{
 		RuleItem *item = mod->getItem(buk->weapon);
 		if (buk->hostileTurn() && item != 0 && item->getBattleType() != BT_GRENADE && item->getBattleType() != BT_PROXIMITYGRENADE)
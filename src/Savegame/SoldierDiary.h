@@ -77,7 +77,8 @@ class SoldierDiary
 {
 private:
 	std::vector<SoldierCommendations*> _commendations;
-	std::vector<BattleUnitKills*> _killList;
+	mutable std::vector<BattleUnitKills*> _killList;
+	mutable YAML::Node _killListNode;
 	std::vector<int> _missionIdList;
 	int _daysWoundedTotal, _totalShotByFriendlyCounter, _totalShotFriendlyCounter, _loneSurvivorTotal, _monthsService, _unconciousTotal, _shotAtCounterTotal,
 		_hitCounterTotal, _ironManTotal, _longDistanceHitCounterTotal, _lowAccuracyHitCounterTotal, _shotsFiredCounterTotal, _shotsLandedCounterTotal,
@@ -85,6 +86,9 @@ private:
 		_woundsHealedTotal, _allUFOs, _allMissionTypes, _statGainTotal, _revivedUnitTotal, _wholeMedikitTotal, _braveryGainTotal, _bestOfRank, _MIA,
 		_martyrKillsTotal, _postMortemKills, _slaveKillsTotal, _bestSoldier, _revivedSoldierTotal, _revivedHostileTotal, _revivedNeutralTotal;
 	bool _globeTrotter;
+
+	/// Gets the kill list, decoding it from the save on first use.
+	const std::vector<BattleUnitKills*> &getKillList() const;
 public:
 	/// Construct a diary.
 	SoldierDiary();
@@ -47,6 +47,24 @@ Tile::SerializationKey Tile::serializationKey =
  4 + 2*4 + 2*4 + 1 + 1 + 1 // total bytes to save one tile
 };
 
+/**
+ * Gets the IDs of the map data of this tile, stored by the battle for all tiles.
+ * @return IDs of each tile part.
+ */
+Tile::TileMapDataCache &Tile::getMapDataCache()
+{
+	return _save->getTileMapDataCache(_save->getTileIndex(_pos));
+}
+
+/**
+ * Gets the IDs of the map data of this tile, stored by the battle for all tiles.
+ * @return IDs of each tile part.
+ */
+const Tile::TileMapDataCache &Tile::getMapDataCache() const
+{
+	return _save->getTileMapDataCache(_save->getTileIndex(_pos));
+}
+
 /**
  * constructor
  * @param pos Position.
@@ -56,8 +74,8 @@ Tile::Tile(Position pos, SavedBattleGame* save): _save(save), _pos(pos)
 	for (int i = 0; i < O_MAX; ++i)
 	{
 		_objects[i] = 0;
-		_mapData->ID[i] = -1;
-		_mapData->SetID[i] = -1;
+		getMapDataCache().ID[i] = -1;
+		getMapDataCache().SetID[i] = -1;
 		_objectsCache[i].currentFrame = 0;
 	}
 	for (int layer = 0; layer < LL_MAX; layer++)
@@ -92,8 +110,8 @@ void Tile::load(const YAML::Node &node)
 	//_position = node["position"].as<Position>(_position);
 	for (int i = 0; i < 4; i++)
 	{
-		_mapData->ID[i] = node["mapDataID"][i].as<int>(_mapData->ID[i]);
-		_mapData->SetID[i] = node["mapDataSetID"][i].as<int>(_mapData->SetID[i]);
+		getMapDataCache().ID[i] = node["mapDataID"][i].as<int>(getMapDataCache().ID[i]);
+		getMapDataCache().SetID[i] = node["mapDataSetID"][i].as<int>(getMapDataCache().SetID[i]);
 	}
 	_fire = node["fire"].as<int>(_fire);
 	_smoke = node["smoke"].as<int>(_smoke);
@@ -126,14 +144,14 @@ void Tile::load(const YAML::Node &node)
  */
 void Tile::loadBinary(Uint8 *buffer, Tile::SerializationKey& serKey)
 {
-	_mapData->ID[0] = unserializeInt(&buffer, serKey._mapDataID);
-	_mapData->ID[1] = unserializeInt(&buffer, serKey._mapDataID);
-	_mapData->ID[2] = unserializeInt(&buffer, serKey._mapDataID);
-	_mapData->ID[3] = unserializeInt(&buffer, serKey._mapDataID);
-	_mapData->SetID[0] = unserializeInt(&buffer, serKey._mapDataSetID);
-	_mapData->SetID[1] = unserializeInt(&buffer, serKey._mapDataSetID);
-	_mapData->SetID[2] = unserializeInt(&buffer, serKey._mapDataSetID);
-	_mapData->SetID[3] = unserializeInt(&buffer, serKey._mapDataSetID);
+	getMapDataCache().ID[0] = unserializeInt(&buffer, serKey._mapDataID);
+	getMapDataCache().ID[1] = unserializeInt(&buffer, serKey._mapDataID);
+	getMapDataCache().ID[2] = unserializeInt(&buffer, serKey._mapDataID);
+	getMapDataCache().ID[3] = unserializeInt(&buffer, serKey._mapDataID);
+	getMapDataCache().SetID[0] = unserializeInt(&buffer, serKey._mapDataSetID);
+	getMapDataCache().SetID[1] = unserializeInt(&buffer, serKey._mapDataSetID);
+	getMapDataCache().SetID[2] = unserializeInt(&buffer, serKey._mapDataSetID);
+	getMapDataCache().SetID[3] = unserializeInt(&buffer, serKey._mapDataSetID);
 
 	_smoke = unserializeInt(&buffer, serKey._smoke);
 	_fire = unserializeInt(&buffer, serKey._fire);
@@ -161,8 +179,8 @@ YAML::Node Tile::save() const
 	node["position"] = _pos;
 	for (int i = 0; i < 4; i++)
 	{
-		node["mapDataID"].push_back(_mapData->ID[i]);
-		node["mapDataSetID"].push_back(_mapData->SetID[i]);
+		node["mapDataID"].push_back(getMapDataCache().ID[i]);
+		node["mapDataSetID"].push_back(getMapDataCache().SetID[i]);
 	}
 	if (_smoke)
 		node["smoke"] = _smoke;
@@ -193,14 +211,14 @@ YAML::Node Tile::save() const
  */
 void Tile::saveBinary(Uint8** buffer) const
 {
-	serializeInt(buffer, serializationKey._mapDataID, _mapData->ID[0]);
-	serializeInt(buffer, serializationKey._mapDataID, _mapData->ID[1]);
-	serializeInt(buffer, serializationKey._mapDataID, _mapData->ID[2]);
-	serializeInt(buffer, serializationKey._mapDataID, _mapData->ID[3]);
-	serializeInt(buffer, serializationKey._mapDataSetID, _mapData->SetID[0]);
-	serializeInt(buffer, serializationKey._mapDataSetID, _mapData->SetID[1]);
-	serializeInt(buffer, serializationKey._mapDataSetID, _mapData->SetID[2]);
-	serializeInt(buffer, serializationKey._mapDataSetID, _mapData->SetID[3]);
+	serializeInt(buffer, serializationKey._mapDataID, getMapDataCache().ID[0]);
+	serializeInt(buffer, serializationKey._mapDataID, getMapDataCache().ID[1]);
+	serializeInt(buffer, serializationKey._mapDataID, getMapDataCache().ID[2]);
+	serializeInt(buffer, serializationKey._mapDataID, getMapDataCache().ID[3]);
+	serializeInt(buffer, serializationKey._mapDataSetID, getMapDataCache().SetID[0]);
+	serializeInt(buffer, serializationKey._mapDataSetID, getMapDataCache().SetID[1]);
+	serializeInt(buffer, serializationKey._mapDataSetID, getMapDataCache().SetID[2]);
+	serializeInt(buffer, serializationKey._mapDataSetID, getMapDataCache().SetID[3]);
 
 	serializeInt(buffer, serializationKey._smoke, _smoke);
 	serializeInt(buffer, serializationKey._fire, _fire);
@@ -221,8 +239,8 @@ void Tile::saveBinary(Uint8** buffer) const
 void Tile::setMapData(MapData *dat, int mapDataID, int mapDataSetID, TilePart part)
 {
 	_objects[part] = dat;
-	_mapData->ID[part] = mapDataID;
-	_mapData->SetID[part] = mapDataSetID;
+	getMapDataCache().ID[part] = mapDataID;
+	getMapDataCache().SetID[part] = mapDataSetID;
 	_objectsCache[part].isDoor = dat ? dat->isDoor() : 0;
 	_objectsCache[part].isUfoDoor = dat ? dat->isUFODoor() : 0;
 	_objectsCache[part].offsetY = dat ? dat->getYOffset() : 0;
@@ -278,8 +296,8 @@ void Tile::setMapData(MapData *dat, int mapDataID, int mapDataSetID, TilePart pa
  */
 void Tile::getMapData(int *mapDataID, int *mapDataSetID, TilePart part) const
 {
-	*mapDataID = _mapData->ID[part];
-	*mapDataSetID = _mapData->SetID[part];
+	*mapDataID = getMapDataCache().ID[part];
+	*mapDataSetID = getMapDataCache().SetID[part];
 }
 
 /**
@@ -384,7 +402,7 @@ int Tile::openDoor(TilePart part, BattleUnit *unit, BattleActionType reserve, bo
 			return 4;
 		if (_unit && _unit != unit && _unit->getPosition() != getPosition())
 			return -1;
-		setMapData(_objects[part]->getDataset()->getObject(_objects[part]->getAltMCD()), _objects[part]->getAltMCD(), _mapData->SetID[part],
+		setMapData(_objects[part]->getDataset()->getObject(_objects[part]->getAltMCD()), _objects[part]->getAltMCD(), getMapDataCache().SetID[part],
 				   _objects[part]->getDataset()->getObject(_objects[part]->getAltMCD())->getObjectType());
 		setMapData(0, -1, -1, part);
 		return 0;
@@ -541,7 +559,7 @@ bool Tile::destroy(TilePart part, SpecialTileType type)
 			return false;
 		_objective = _objects[part]->getSpecialType() == type;
 		MapData *originalPart = _objects[part];
-		int originalMapDataSetID = _mapData->SetID[part];
+		int originalMapDataSetID = getMapDataCache().SetID[part];
 		setMapData(0, -1, -1, part);
 		if (originalPart->getDieMCD())
 		{
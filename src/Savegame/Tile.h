@@ -76,6 +76,7 @@ public:
 
 	/**
 	 * Cache of ID for tile parts used to save and load.
+	 * Rarely used, so it is kept by SavedBattleGame in a separate array indexed like the tiles.
 	 */
 	struct TileMapDataCache
 	{
@@ -114,7 +115,6 @@ protected:
 	MapData *_objects[O_MAX];
 	BattleUnit *_unit = nullptr;
 	std::vector<BattleItem *> _inventory;
-	std::unique_ptr<TileMapDataCache> _mapData = std::make_unique<TileMapDataCache>();
 	SurfaceRaw<const Uint8> _currentSurface[O_MAX] = { };
 	TileObjectCache _objectsCache[O_MAX] = { };
 	TileCache _cache = { };
@@ -133,6 +133,10 @@ protected:
 	Sint8 _preview = -1;
 	Uint8 _overlaps = 0;
 
+	/// Gets the IDs of the map data of this tile.
+	TileMapDataCache &getMapDataCache();
+	/// Gets the IDs of the map data of this tile.
+	const TileMapDataCache &getMapDataCache() const;
 
 public:
 	/// Creates a tile.
@@ -174,7 +174,7 @@ Craft *Transfer::getCraft()
  * Returns the items being transferred.
  * @return Item ID.
  */
-std::string Transfer::getItems() const
+const std::string &Transfer::getItems() const
 {
 	return _itemId;
 }
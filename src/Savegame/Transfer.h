@@ -84,7 +84,7 @@ public:
 	/// Gets the craft of the transfer.
 	Craft *getCraft();
 	/// Gets the items of the transfer.
-	std::string getItems() const;
+	const std::string &getItems() const;
 	/// Sets the items of the transfer.
 	void setItems(const std::string &id, int qty = 1);
 	/// Sets the scientists of the transfer.